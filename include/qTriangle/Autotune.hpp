@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "qTriangle.hpp"
+
+namespace qTri
+{
+// Shape of the work a caller intends to hand to the kernels
+struct Workload
+{
+	// Extent of the grid of points that triangles are tested against
+	std::size_t Width;
+	std::size_t Height;
+	// Typical width and height of a triangle's bounding box
+	std::size_t TriangleSize;
+	// Largest coordinate magnitude that will be passed to the kernels
+	std::int32_t CoordinateLimit;
+	// Points on any edge of a triangle must be covered
+	bool InclusiveEdges;
+};
+
+// Whether the running processor can execute kernels compiled for ISA, such
+// as "Serial", "SSE4.1", "AVX2" or "AVX512F"
+// Unknown instruction sets are never supported
+bool ISASupported(const char* ISA);
+
+// Kernels of Kernels that the running processor supports and whose
+// capabilities satisfy the workload
+std::vector<const FillKernel*> EligibleKernels(
+	const Workload& Shape, const std::vector<FillKernel>& Kernels = FillAlgorithms
+);
+
+// Micro-benchmarks the eligible kernels against a synthetic instance of the
+// workload and returns the fastest, or nullptr if no kernel is eligible
+// When CachePath is given, a previous decision for the same workload and set
+// of kernels is read from it, and new decisions are appended to it
+const FillKernel* Autotune(const Workload& Shape, const char* CachePath = nullptr);
+}
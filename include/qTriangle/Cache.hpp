@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <list>
+#include <unordered_map>
+
+#include "qTriangle.hpp"
+
+namespace qTri
+{
+// Least-recently-used cache of triangle coverage
+// Coverage only depends on the shape of a triangle and not where it is, so
+// triangles are keyed by their vertices relative to the corner of their
+// bounds, and the bit-packed coverage of those bounds is shifted into place
+// on a hit. Suits traffic that repeats the same shapes, such as sprites,
+// glyphs and UI, across small grids.
+class CoverageCache
+{
+public:
+	// Triangles with bounds larger than this along either axis are not
+	// cached and are filled directly
+	static constexpr std::int32_t MaxExtent = 256;
+
+	struct Counters
+	{
+		std::size_t Hits = 0;
+		std::size_t Misses = 0;
+		// Entries dropped to make room for new ones
+		std::size_t Evictions = 0;
+		// Triangles too large to be cached
+		std::size_t Bypasses = 0;
+
+		double HitRate() const
+		{
+			const std::size_t Lookups = Hits + Misses;
+			return Lookups ? static_cast<double>(Hits) / Lookups : 0.0;
+		}
+	};
+
+	// Capacity is the number of shapes held at once, Fill rasterizes the
+	// shapes that miss
+	CoverageCache(std::size_t Capacity, FillFunction Fill);
+
+	// ORs the coverage of Tri into View, the same as qTri::FillView
+	void FillView(const ImageView& View, const Triangle& Tri);
+
+	const Counters& Stats() const
+	{
+		return CurStats;
+	}
+
+	void ResetStats()
+	{
+		CurStats = Counters{};
+	}
+
+	std::size_t Size() const
+	{
+		return Entries.size();
+	}
+
+	void Clear()
+	{
+		Entries.clear();
+		Index.clear();
+	}
+
+private:
+	// Vertices relative to the minimum corner of the triangle's bounds
+	using Key = std::array<glm::i32vec2,3>;
+
+	struct KeyHash
+	{
+		std::size_t operator()(const Key& Shape) const;
+	};
+
+	struct Entry
+	{
+		Key Shape;
+		BasicImage<Bit8> Coverage;
+	};
+
+	std::size_t Capacity;
+	FillFunction Fill;
+	Counters CurStats;
+
+	// Most recently used first
+	std::list<Entry> Entries;
+	std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> Index;
+};
+}
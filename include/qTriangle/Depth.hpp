@@ -0,0 +1,328 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "Types.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace qTri
+{
+// Depth storage, lower depths are nearer
+// Depths are interpolated in single precision and quantized to the format
+// before they are compared, so that stored and incoming depths agree
+template<typename DepthT>
+struct DepthFormat;
+
+template<>
+struct DepthFormat<float>
+{
+	static constexpr float Far = std::numeric_limits<float>::infinity();
+
+	static float Quantize(float Depth)
+	{
+		return Depth;
+	}
+};
+
+// Unsigned normalized, [0,65535]
+template<>
+struct DepthFormat<std::uint16_t>
+{
+	static constexpr std::uint16_t Far = 0xFFFF;
+
+	static float Quantize(float Depth)
+	{
+		return std::nearbyint(std::min(std::max(Depth, 0.0f), 65535.0f));
+	}
+};
+
+// A depth image alongside the farthest depth of each of its tiles
+// Tiles whose farthest depth is nearer than all of a triangle are rejected
+// without evaluating any of their pixels
+template<typename DepthT>
+class DepthBuffer
+{
+public:
+	static constexpr std::size_t TileSize = 8;
+
+	DepthBuffer(std::size_t Width, std::size_t Height)
+		: Depth(Width, Height),
+		TileMax(
+			(Width + TileSize - 1) / TileSize, (Height + TileSize - 1) / TileSize
+		)
+	{
+		Clear();
+	}
+
+	void Clear()
+	{
+		std::fill(Depth.Pixels.begin(), Depth.Pixels.end(), DepthFormat<DepthT>::Far);
+		std::fill(TileMax.Pixels.begin(), TileMax.Pixels.end(), DepthFormat<DepthT>::Far);
+	}
+
+	// Recomputes the farthest depth of a tile after it was written to
+	void UpdateTile(std::size_t TileX, std::size_t TileY)
+	{
+		const std::size_t EndX = std::min(Depth.Width, (TileX + 1) * TileSize);
+		const std::size_t EndY = std::min(Depth.Height, (TileY + 1) * TileSize);
+		DepthT Max = 0;
+		for( std::size_t y = TileY * TileSize; y < EndY; ++y )
+		{
+			Max = std::max(
+				Max,
+				*std::max_element(Depth.Row(y) + TileX * TileSize, Depth.Row(y) + EndX)
+			);
+		}
+		TileMax.Row(TileY)[TileX] = Max;
+	}
+
+	BasicImage<DepthT> Depth;
+	BasicImage<DepthT> TileMax;
+};
+
+//// Depth tested fill
+
+#if defined(__AVX2__)
+inline __m256 LoadDepth8(const float Depths[])
+{
+	return _mm256_loadu_ps(Depths);
+}
+
+inline __m256 LoadDepth8(const std::uint16_t Depths[])
+{
+	return _mm256_cvtepi32_ps(
+		_mm256_cvtepu16_epi32(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(Depths))
+		)
+	);
+}
+
+inline void StoreDepth8(float Depths[], __m256 Depth)
+{
+	_mm256_storeu_ps(Depths, Depth);
+}
+
+inline void StoreDepth8(std::uint16_t Depths[], __m256 Depth)
+{
+	// | 7 6 5 4 | 7 6 5 4 | 3 2 1 0 | 3 2 1 0 | < packus per 128-bit lane
+	// | . . . . | . . . . | 7 6 5 4 | 3 2 1 0 | < permute4x64
+	const __m256i Depth32 = _mm256_cvtps_epi32(Depth);
+	const __m256i Depth16 = _mm256_permute4x64_epi64(
+		_mm256_packus_epi32(Depth32, Depth32), _MM_SHUFFLE(3, 1, 2, 0)
+	);
+	_mm_storeu_si128(
+		reinterpret_cast<__m128i*>(Depths), _mm256_castsi256_si128(Depth16)
+	);
+}
+
+inline __m256 QuantizeDepth8(__m256 Depth, const float*)
+{
+	return Depth;
+}
+
+inline __m256 QuantizeDepth8(__m256 Depth, const std::uint16_t*)
+{
+	return _mm256_round_ps(
+		_mm256_min_ps(
+			_mm256_max_ps(Depth, _mm256_setzero_ps()), _mm256_set1_ps(65535.0f)
+		),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+}
+#endif
+
+// Depth tests every pixel covered by Tri, where Depths are the depths at each
+// vertex. Pixels that are nearer than the buffer take the interpolated depth
+// and are handed to Write(y, x, Mask), where bit i of Mask marks pixel x + i
+// of row y as having passed.
+// Coverage follows BarycentricMethod, leaving out pixels on the edge from
+// Tri[1] to Tri[2], and Tri must be wound such that edges face inwards.
+template<typename DepthT, typename WriteFunctionT>
+inline void DepthTest(
+	DepthBuffer<DepthT>& Buffer,
+	const Triangle& Tri, const std::array<DepthT,3>& Depths,
+	WriteFunctionT&& Write
+)
+{
+	// Barycentric weights as plane equations over the pixel coordinates
+	// U = Det20 + Det(Tri[0], P) + Det(P, Tri[2]) weighs Tri[1]
+	// V = Det01 + Det(Tri[1], P) + Det(P, Tri[0]) weighs Tri[2]
+	const std::int32_t Det01 = Det( Tri[0], Tri[1] );
+	const std::int32_t Det20 = Det( Tri[2], Tri[0] );
+	const std::int32_t Area  = Det( Tri[1], Tri[2] ) + Det20 + Det01;
+	if( Area <= 0 )
+	{
+		return;
+	}
+	const glm::i32vec2 UStep(Tri[2].y - Tri[0].y, Tri[0].x - Tri[2].x);
+	const glm::i32vec2 VStep(Tri[0].y - Tri[1].y, Tri[1].x - Tri[0].x);
+
+	// Depth as a plane through Tri[0]
+	const double DepthU = (double(Depths[1]) - Depths[0]) / Area;
+	const double DepthV = (double(Depths[2]) - Depths[0]) / Area;
+	const float DepthOrigin = Depths[0];
+	const float DepthStepX = static_cast<float>(DepthU * UStep.x + DepthV * VStep.x);
+	const float DepthStepY = static_cast<float>(DepthU * UStep.y + DepthV * VStep.y);
+	const DepthT NearestDepth = std::min({Depths[0], Depths[1], Depths[2]});
+
+	// Bounds of the triangle, clipped to the buffer
+	const glm::i32vec2 Min = glm::max(
+		glm::min(Tri[0], glm::min(Tri[1], Tri[2])), glm::i32vec2(0)
+	);
+	const glm::i32vec2 Max = glm::min(
+		glm::max(Tri[0], glm::max(Tri[1], Tri[2])),
+		glm::i32vec2(Buffer.Depth.Width - 1, Buffer.Depth.Height - 1)
+	);
+	if(
+		Buffer.Depth.Width == 0 || Buffer.Depth.Height == 0
+		|| Min.x > Max.x || Min.y > Max.y
+	)
+	{
+		return;
+	}
+
+	constexpr std::int32_t TileSize = DepthBuffer<DepthT>::TileSize;
+#if defined(__AVX2__)
+	const __m256i Lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i UStepx = _mm256_set1_epi32(UStep.x);
+	const __m256i VStepx = _mm256_set1_epi32(VStep.x);
+	const __m256i AreaLimit = _mm256_set1_epi32(Area - 1);
+	const __m256 DepthStepx = _mm256_set1_ps(DepthStepX);
+#endif
+	for( std::int32_t TileY = Min.y / TileSize; TileY <= Max.y / TileSize; ++TileY )
+	{
+		for( std::int32_t TileX = Min.x / TileSize; TileX <= Max.x / TileSize; ++TileX )
+		{
+			// Early-z, nothing in the tile is farther than the triangle
+			if( NearestDepth >= Buffer.TileMax.Row(TileY)[TileX] )
+			{
+				continue;
+			}
+			const std::int32_t BeginX = std::max(Min.x, TileX * TileSize);
+			const std::int32_t EndX = std::min(Max.x + 1, (TileX + 1) * TileSize);
+			const std::int32_t BeginY = std::max(Min.y, TileY * TileSize);
+			const std::int32_t EndY = std::min(Max.y + 1, (TileY + 1) * TileSize);
+			bool Written = false;
+			for( std::int32_t y = BeginY; y < EndY; ++y )
+			{
+				DepthT* const DepthRow = Buffer.Depth.Row(y);
+				const std::int32_t RowU = Det20
+					+ Det( Tri[0], glm::i32vec2(0, y) ) + Det( glm::i32vec2(0, y), Tri[2] );
+				const std::int32_t RowV = Det01
+					+ Det( Tri[1], glm::i32vec2(0, y) ) + Det( glm::i32vec2(0, y), Tri[0] );
+				const float RowDepth = DepthOrigin
+					+ DepthStepY * static_cast<float>(y - Tri[0].y);
+				std::int32_t x = BeginX;
+#if defined(__AVX2__)
+				if( EndX - x == TileSize )
+				{
+					const __m256i Pointx = _mm256_add_epi32(_mm256_set1_epi32(x), Lanes);
+					const __m256i U = _mm256_add_epi32(
+						_mm256_set1_epi32(RowU), _mm256_mullo_epi32(UStepx, Pointx)
+					);
+					const __m256i V = _mm256_add_epi32(
+						_mm256_set1_epi32(RowV), _mm256_mullo_epi32(VStepx, Pointx)
+					);
+					// U >= 0, V >= 0 and U + V <= Area - 1 as sign bits
+					const __m256i Outside = _mm256_or_si256(
+						_mm256_or_si256(U, V),
+						_mm256_sub_epi32(AreaLimit, _mm256_add_epi32(U, V))
+					);
+					const __m256 Depth = QuantizeDepth8(
+						_mm256_add_ps(
+							_mm256_set1_ps(RowDepth),
+							_mm256_mul_ps(
+								DepthStepx,
+								_mm256_cvtepi32_ps(
+									_mm256_sub_epi32(Pointx, _mm256_set1_epi32(Tri[0].x))
+								)
+							)
+						),
+						DepthRow
+					);
+					const __m256 Stored = LoadDepth8(DepthRow + x);
+					const __m256 Passed = _mm256_andnot_ps(
+						_mm256_castsi256_ps(Outside),
+						_mm256_cmp_ps(Depth, Stored, _CMP_LT_OQ)
+					);
+					const std::uint32_t Mask = _mm256_movemask_ps(Passed);
+					if( Mask )
+					{
+						StoreDepth8(DepthRow + x, _mm256_blendv_ps(Stored, Depth, Passed));
+						Write(y, x, Mask);
+						Written = true;
+					}
+					continue;
+				}
+#endif
+				for( ; x < EndX; ++x )
+				{
+					const std::int32_t U = RowU + UStep.x * x;
+					const std::int32_t V = RowV + VStep.x * x;
+					if( U < 0 || V < 0 || U + V >= Area )
+					{
+						continue;
+					}
+					const float Depth = DepthFormat<DepthT>::Quantize(
+						RowDepth + DepthStepX * static_cast<float>(x - Tri[0].x)
+					);
+					if( Depth < static_cast<float>(DepthRow[x]) )
+					{
+						DepthRow[x] = static_cast<DepthT>(Depth);
+						Write(y, x, 1);
+						Written = true;
+					}
+				}
+			}
+			if( Written )
+			{
+				Buffer.UpdateTile(TileX, TileY);
+			}
+		}
+	}
+}
+
+// Sets the coverage of every pixel of Tri that passes the depth test to 1
+// Coverage and the buffer share dimensions
+template<typename DepthT>
+inline void DepthFill(
+	Image& Coverage, DepthBuffer<DepthT>& Buffer,
+	const Triangle& Tri, const std::array<DepthT,3>& Depths
+)
+{
+	DepthTest(
+		Buffer, Tri, Depths,
+		[&Coverage](std::size_t y, std::size_t x, std::uint32_t Mask)
+		{
+			PixelFormat<std::uint8_t>::Write(Coverage.Row(y), x, Mask, 1);
+		}
+	);
+}
+
+// Writes ID into every pixel of Tri that passes the depth test, so that the
+// nearest triangle of each pixel remains regardless of submission order
+// IDs and the buffer share dimensions
+template<typename DepthT>
+inline void DepthVisibility(
+	BasicImage<std::uint32_t>& IDs, DepthBuffer<DepthT>& Buffer,
+	const Triangle& Tri, const std::array<DepthT,3>& Depths, std::uint32_t ID
+)
+{
+	DepthTest(
+		Buffer, Tri, Depths,
+		[&IDs, ID](std::size_t y, std::size_t x, std::uint32_t Mask)
+		{
+			PixelFormat<std::uint32_t>::Write(IDs.Row(y), x, Mask, ID);
+		}
+	);
+}
+}
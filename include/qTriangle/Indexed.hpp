@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <vector>
+
+#include "qTriangle.hpp"
+
+namespace qTri
+{
+// How the indices of an IndexedTriangles are assembled into triangles
+enum class Topology
+{
+	// Every three indices are a triangle
+	List,
+	// Each index after the first two forms a triangle with the two before it,
+	// every other triangle is flipped to keep the winding of the first
+	Strip,
+	// Each index after the first two forms a triangle with the one before it
+	// and the first index
+	Fan
+};
+
+// Cross-Product of the edge from V0 to V1 as a function of the point,
+// Det(V1 - V0, P - V0) = A * P.x + B * P.y + C
+// The edge from V1 to V0 is the same function negated
+struct EdgeFunction
+{
+	std::int32_t A;
+	std::int32_t B;
+	std::int32_t C;
+};
+
+// Triangles sharing a vertex buffer, set up once for filling
+// Each unique edge's function is computed only once and shared by the two
+// triangles on either side of it, negated for the one that walks it in the
+// opposite direction. Strips and fans find shared edges from their order,
+// lists find them by their pair of vertex indices.
+// Triangles follow the winding of qTri::Triangle, strips and fans that
+// repeat an index between consecutive triangles are skipped as restarts
+class IndexedTriangles
+{
+public:
+	IndexedTriangles(
+		std::vector<glm::i32vec2> Vertices,
+		std::vector<std::uint32_t> Indices,
+		Topology Primitive
+	);
+
+	Triangle GetTriangle(std::size_t Face) const
+	{
+		return Triangle{
+			{
+				Vertices[Faces[Face][0]],
+				Vertices[Faces[Face][1]],
+				Vertices[Faces[Face][2]]
+			}
+		};
+	}
+
+	std::vector<glm::i32vec2> Vertices;
+	// Vertex indices of each triangle
+	std::vector<std::array<std::uint32_t,3>> Faces;
+	// Unique edges
+	std::vector<EdgeFunction> Edges;
+	// FaceEdges[Face][i] is (Edge << 1 | Negated) for the edge from
+	// Faces[Face][i] to Faces[Face][(i + 1) % 3]
+	std::vector<std::array<std::uint32_t,3>> FaceEdges;
+};
+
+// ORs the coverage of every triangle of Mesh into View, with each pixel at
+// its coordinate relative to the view's Origin
+// Covers the same pixels as the Cross-Product kernels, including the edges
+void FillView(const ImageView& View, const IndexedTriangles& Mesh);
+}
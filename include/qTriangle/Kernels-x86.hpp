@@ -0,0 +1,1038 @@
+#pragma once
+// Included by Kernels.hpp within namespace qTri
+
+// Widest specializations available
+#if defined(__AVX2__)
+constexpr std::uint8_t CrossProductWidthExp2 = 1;
+constexpr const char* CrossProductISA = "AVX2";
+#else
+constexpr std::uint8_t CrossProductWidthExp2 = 0;
+constexpr const char* CrossProductISA = "SSE4.1";
+#endif
+constexpr std::uint8_t BarycentricWidthExp2 = 0;
+constexpr const char* SerialISA = "SSE4.1";
+constexpr const char* BarycentricISA = SerialISA;
+#if defined(__AVX512F__)
+constexpr std::uint8_t CrossProductCompactWidthExp2 = 4;
+constexpr const char* CrossProductCompactISA = "AVX512F";
+#elif defined(__AVX2__)
+constexpr std::uint8_t CrossProductCompactWidthExp2 = 3;
+constexpr const char* CrossProductCompactISA = "AVX2";
+#else
+constexpr std::uint8_t CrossProductCompactWidthExp2 = 0;
+constexpr const char* CrossProductCompactISA = "Serial";
+#endif
+constexpr std::uint8_t CrossProductQueryWidthExp2 = CrossProductCompactWidthExp2;
+constexpr const char* CrossProductQueryISA = CrossProductCompactISA;
+#if defined(__AVX2__)
+constexpr std::uint8_t CrossProductWriteWidthExp2 = 3;
+constexpr const char* CrossProductWriteISA = "AVX2";
+#else
+constexpr std::uint8_t CrossProductWriteWidthExp2 = 0;
+constexpr const char* CrossProductWriteISA = "Serial";
+#endif
+
+#if defined(__SSE4_1__)
+
+// Serial
+template<>
+inline void CrossProductMethod<0>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	// [ Tri[1].y, Tri[1].x, Tri[0].y, Tri[0].x]
+	const __m128i Tri10 = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(Tri.data())
+	);
+	// [ Tri[2].y, Tri[2].x, Tri[2].y, Tri[2].x]
+	const __m128i Tri22 = _mm_set1_epi64x(
+		*reinterpret_cast<const std::uint64_t*>(Tri.data() + 2)
+	);
+
+	// unpacklo(above)
+	// [ Tri[2].y, Tri[0].y, Tri[2].x, Tri[0].x]
+	// unpackhi(above)
+	// [ Tri[2].y, Tri[1].y, Tri[2].x, Tri[1].x]
+	const __m128i Tri20yyxx = _mm_unpacklo_epi32(
+		Tri10, Tri22
+	);
+	const __m128i Tri21yyxx = _mm_unpackhi_epi32(
+		Tri10, Tri22
+	);
+
+	// unpacklo(above)
+	// [ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x]
+	// unpackhi(above)
+	// [ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y]
+	const __m128i Tri2210x = _mm_unpacklo_epi32(
+		Tri20yyxx, Tri21yyxx
+	);
+	const __m128i Tri2210y = _mm_unpackhi_epi32(
+		Tri20yyxx, Tri21yyxx
+	);
+
+	// [ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x]
+	// - 
+	// [ Tri[2].x, Tri[1].x, Tri[0].x, Tri[2].x]
+	//   ^ alignr_epi8([ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x],12)
+	const __m128i EdgeDirx = _mm_sub_epi32(
+		Tri2210x,
+		_mm_alignr_epi8(
+			Tri2210x,Tri2210x,
+			12
+		)
+	);
+	// [ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y]
+	// - 
+	// [ Tri[2].y, Tri[1].y, Tri[0].y, Tri[2].y]
+	//   ^ alignr_epi8([ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y],12)
+	const __m128i EdgeDiry = _mm_sub_epi32(
+		Tri2210y,
+		_mm_alignr_epi8(
+			Tri2210y,Tri2210y,
+			12
+		)
+	);
+
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		const __m128i CurPoint = _mm_loadl_epi64(
+			reinterpret_cast<const __m128i*>(&Points[i])
+		);
+		const __m128i CurPointx = _mm_shuffle_epi32(
+			CurPoint, 0b00'00'00'00
+		);
+		const __m128i CurPointy = _mm_shuffle_epi32(
+			CurPoint, 0b01'01'01'01
+		);
+		// PointDirx = Point[i].x - Tri2210x
+		// PointDiry = Point[i].y - Tri2210y
+
+		const __m128i PointDirx = _mm_sub_epi32(
+			CurPointx, Tri2210x
+		);
+		const __m128i PointDiry = _mm_sub_epi32(
+			CurPointy, Tri2210y
+		);
+		// |   --   |  EdgeDir[2].x |  EdgeDir[1].x |  EdgeDir[0].x | < EdgeDirX
+		//                     |    mul    |
+		// |   --   | PointDir[2].y | PointDir[1].y | PointDir[0].y | < PointDiry
+		//                     |    sub    |
+		// |   --   |  EdgeDir[2].y |  EdgeDir[1].y |  EdgeDir[0].y | < EdgeDiry
+		//                     |    mul    |
+		// |   --   | PointDir[2].x | PointDir[1].x | PointDir[0].x | < PointDirx
+
+		// We're only checking if the signs are >=0 so there is a lot of
+		// optimization that can be done, such as eliminating the subtraction
+		// in the determinant to just comparing the two products directly
+		// ex: a.x*b.y - a.y*b.x >= 0
+		//     a.x*b.y >= a.y*b.x
+		// DetHi = EdgeDirx * PointDiry
+		// DetLo = EdgeDiry * PointDirx
+		const __m128i DetHi = _mm_mullo_epi32(
+			EdgeDirx, PointDiry
+		);
+		const __m128i DetLo = _mm_mullo_epi32(
+			EdgeDiry, PointDirx
+		);
+
+		const std::uint16_t CheckMask = _mm_movemask_epi8(
+			_mm_cmplt_epi32(
+				DetHi, DetLo
+			)
+		) & 0x0'F'F'F;
+
+		// Check = DetHi >= DetLo = -(DetHi < DetLo)
+		Results[i] |= CheckMask == 0x0'0'0'0;
+	}
+}
+
+#if defined(__AVX2__)
+
+// Two at a time
+template<>
+inline void CrossProductMethod<1>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	// [ Tri[1].y, Tri[1].x, Tri[0].y, Tri[0].x]
+	const __m128i Tri10 = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(Tri.data())
+	);
+	// [ Tri[2].y, Tri[2].x, Tri[2].y, Tri[2].x]
+	const __m128i Tri22 = _mm_set1_epi64x(
+		*reinterpret_cast<const std::uint64_t*>(Tri.data() + 2)
+	);
+
+	// unpacklo(above)
+	// [ Tri[2].y, Tri[0].y, Tri[2].x, Tri[0].x]
+	// unpackhi(above)
+	// [ Tri[2].y, Tri[1].y, Tri[2].x, Tri[1].x]
+	const __m128i Tri20yyxx = _mm_unpacklo_epi32(
+		Tri10, Tri22
+	);
+	const __m128i Tri21yyxx = _mm_unpackhi_epi32(
+		Tri10, Tri22
+	);
+
+	// unpacklo(above)
+	// [ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x]
+	// unpackhi(above)
+	// [ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y]
+	const __m256i Tri2210x2x = _mm256_broadcastsi128_si256(
+		_mm_unpacklo_epi32(
+			Tri20yyxx, Tri21yyxx
+		)
+	);
+	const __m256i Tri2210x2y = _mm256_broadcastsi128_si256(
+			_mm_unpackhi_epi32(
+			Tri20yyxx, Tri21yyxx
+		)
+	);
+
+	// [ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x]
+	// - 
+	// [ Tri[2].x, Tri[1].x, Tri[0].x, Tri[2].x]
+	//   ^ alignr_epi8([ Tri[2].x, Tri[2].x, Tri[1].x, Tri[0].x],12)
+	const __m256i EdgeDirx2x =
+	_mm256_sub_epi32(
+			Tri2210x2x,
+			_mm256_alignr_epi8(
+				Tri2210x2x,Tri2210x2x,
+				12
+		)
+	);
+	// [ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y]
+	// - 
+	// [ Tri[2].y, Tri[1].y, Tri[0].y, Tri[2].y]
+	//   ^ alignr_epi8([ Tri[2].y, Tri[2].y, Tri[1].y, Tri[0].y],12)
+	const __m256i EdgeDirx2y =
+	_mm256_sub_epi32(
+			Tri2210x2y,
+			_mm256_alignr_epi8(
+				Tri2210x2y,Tri2210x2y,
+				12
+		)
+	);
+
+	std::size_t i = 0;
+	for( ; i + 1 < Count; i += 2 )
+	{
+		const __m256i CurPointx2 = _mm256_permute4x64_epi64(
+			_mm256_castsi128_si256(
+				_mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(&Points[i])
+				)
+			),
+			0b01'01'00'00
+		);
+		const __m256i CurPointx2x = _mm256_shuffle_epi32(
+			CurPointx2, 0b00'00'00'00
+		);
+		const __m256i CurPointx2y = _mm256_shuffle_epi32(
+			CurPointx2, 0b01'01'01'01
+		);
+
+		const __m256i PointDirx2x = _mm256_sub_epi32(
+			CurPointx2x, Tri2210x2x
+		);
+		const __m256i PointDirx2y = _mm256_sub_epi32(
+			CurPointx2y, Tri2210x2y
+		);
+		const __m256i DetHix2 = _mm256_mullo_epi32(
+			EdgeDirx2x, PointDirx2y
+		);
+		const __m256i DetLox2 = _mm256_mullo_epi32(
+			EdgeDirx2y, PointDirx2x
+		);
+		// Check = DetHi >= DetLo = -(DetHi < DetLo) = ~(DetLo > DetHi)
+		const std::uint32_t CheckMaskx2 = (~_mm256_movemask_epi8(
+			_mm256_cmpgt_epi32(
+				DetLox2, DetHix2
+			)
+		) & 0x0'F'F'F'0'F'F'F) + 0x0001'0001;
+
+		*reinterpret_cast<std::uint16_t*>(Results + i) |=
+			static_cast<std::uint16_t>(
+				0x0101'0100'0001'0000 >> (_pext_u32( CheckMaskx2, 0x1000'1000) * 16)
+			);
+		
+		// Results[i + 0] |= (CheckMaskx2 & 0x0000FFFF) == 0;
+		// Results[i + 1] |= (CheckMaskx2 & 0xFFFF0000) == 0;
+	}
+	// Remaining odd point
+	CrossProductMethod<0>(
+		Points + i, Results + i, Count - i, Tri
+	);
+}
+#endif
+
+template<>
+inline void BarycentricMethod<0>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const qTri::Triangle& Tri
+)
+{
+	// [ Tri[1].y, Tri[1].x, Tri[0].y, Tri[0].x]
+	const __m128i Tri10 = _mm_loadu_si128(
+		reinterpret_cast<const __m128i*>(Tri.data())
+	);
+	// [ Tri[2].y, Tri[2].x, Tri[2].y, Tri[2].x]
+	const __m128i Tri22 = _mm_set1_epi64x(
+		*reinterpret_cast<const std::uint64_t*>(Tri.data() + 2)
+	);
+	// [ Tri[2].y, Tri[2].x, Tri[1].y, Tri[1].x]
+	const __m128i Tri21 = _mm_alignr_epi8(
+		Tri22, Tri10,
+		8
+	);
+
+	// | Tri[1].x | Tri[0].y | Tri[2].y | Tri[0].x |
+	const __m128i ConstVec_1x0y2y0x = _mm_blend_epi32(
+		_mm_shuffle_epi32(Tri10,0b10'01'00'00),// 1x0y__0x
+		Tri22,                                 // ____2y__
+		0b0010
+	);
+
+	// | Tri[1].y | Tri[0].x | Tri[2].x | Tri[0].y |
+	const __m128i ConstVec_1y0x2x0y = _mm_blend_epi32(
+		_mm_shuffle_epi32(Tri10,0b11'00'00'01),// 1y0x__0y
+		_mm_shuffle_epi32(Tri22,0b00'00'00'00),// ____2x__
+		0b0010
+	);
+
+	// Det01: Tri[1].y * Tri[0].x - Tri[0].y * Tri[1].x
+	// Det20: Tri[2].x * Tri[0].y - Tri[0].x * Tri[2].y
+
+	// | Tri[1].y | Tri[2].x | Tri[1].y | Tri[2].x |
+	// |    *     |    *     |    *     |    *     |
+	// | Tri[0].x | Tri[0].y | Tri[0].x | Tri[0].y |
+	// |    -     |    -     |    -     |    -     |
+	// | Tri[0].y | Tri[0].x | Tri[0].y | Tri[0].x |
+	// |    *     |    *     |    *     |    *     |
+	// | Tri[1].x | Tri[2].y | Tri[1].x | Tri[2].y |
+	// [  Det01  ,  Det20    ,  Det01   ,  Det20   ]
+	const __m128i Det0120 = _mm_sub_epi32(
+		_mm_mullo_epi32(
+			_mm_shuffle_epi32(Tri21,0b01'10'01'10),
+			_mm_shuffle_epi32(Tri10,0b00'01'00'01)
+		),
+		_mm_mullo_epi32(
+			_mm_shuffle_epi32(Tri10,0b01'00'01'00),
+			_mm_shuffle_epi32(Tri21,0b00'11'00'11)
+		)
+	);
+
+	// Area: Tri[2].y * Tri[1].x - Tri[2].x * Tri[1].y
+	//       + Det20 + Det01
+
+	// | Tri[2].x | Tri[2].y | Tri[2].x | Tri[2].y |
+	// |    *     |    *     |    *     |    *     |
+	// | Tri[1].y | Tri[1].x | Tri[1].y | Tri[1].x |
+	// |         hsub        |         hsub        |
+	// |    +     |    +     |    +     |    +     |
+	// [  Det01   | Det01    |  Det01   |  Det01   ]
+	// |    +     |    +     |    +     |    +     |
+	// [  Det20   | Det20    |  Det20   |  Det20   ]
+	// [  Area    |  Area    |  Area    |  Area    ]
+	const __m128i AreaProduct = _mm_mullo_epi32(
+		_mm_shuffle_epi32(
+			Tri22, 0b00'01'00'01
+		),
+		_mm_shuffle_epi32(
+			Tri10, 0b11'10'11'10
+		)
+	);
+	const __m128i Area = _mm_add_epi32(
+		_mm_hsub_epi32(
+			AreaProduct, AreaProduct
+		),
+		_mm_hadd_epi32(
+			Det0120,Det0120
+		)
+	);
+
+	// [Area-1, Area-1, 0,0]
+	const __m128i CheckConst = _mm_blend_epi16(
+		_mm_setzero_si128(),
+		_mm_sub_epi32( // Area - 1
+			Area,
+			_mm_set1_epi32(1)
+		),
+		0b11'11'00'00
+	);
+
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		// YXYX
+		const __m128i Point = _mm_loadl_epi64(
+			reinterpret_cast<const __m128i*>(Points + i)
+		);
+		const __m128i PointYXXY= _mm_shuffle_epi32(
+			Point,
+			0b01'00'00'01
+		);
+		const __m128i PointXYYX = _mm_alignr_epi8(
+			PointYXXY,PointYXXY,8
+		);
+
+		// U:
+		//   Point.y * Tri[0].x - Point.x * Tri[0].y
+		// +
+		//   Point.x * Tri[2].y - Point.y * Tri[2].x
+		// + Det20
+		// V:
+		//   Point.x * Tri[0].y - Point.y * Tri[0].x
+		// +
+		//   Point.y * Tri[1].x - Point.x * Tri[1].y
+		// + Det01
+
+		// If I wanted to do two at a time, I could fit
+		// two UVs into one 128-bit lane. Putting this
+		// here for reference
+		// |  Point.x |  Point.y |  Point.x |  Point.y |
+		// |    *     |    *     |    *     |    *     |
+		// [ Tri[0].y | Tri[0].x | Tri[0].y | Tri[0].x ] < const
+		// |    -     |    -     |    -     |    -     |
+		// |  Point.y |  Point.x |  Point.y |  Point.x |
+		// |    *     |    *     |    *     |    *     |
+		// [ Tri[0].x | Tri[0].y | Tri[0].x | Tri[0].y ] < const
+		// |    +     |    +     |    +     |    +     |
+		// |  Point.y |  Point.x |  Point.y |  Point.x |
+		// |    *     |    *     |    *     |    *     |
+		// [ Tri[1].x | Tri[2].y | Tri[1].x | Tri[2].y ] < const
+		// |    -     |    -     |    -     |    -     |
+		// |  Point.x |  Point.y |  Point.x |  Point.y |
+		// |    *     |    *     |    *     |    *     |
+		// [ Tri[1].y | Tri[2].x | Tri[1].y | Tri[2].x ] < const
+		// |    +     |    +     |    +     |    +     |
+		// [  Det01   |  Det20   |  Det01   |  Det20   ] < const
+		// |    V1    |    U1    |    V0    |    U0    |
+
+		// If I wanted to do 1 at a time though,
+		// I could utilize more lanes to do
+		// independent calculations in parallel
+		// Such as the adds and multplications
+
+		// |  Point.x |  Point.y | xy
+		// |    *     |    *     |
+		// | Tri[0].y | Tri[0].x ] < const
+		// |    -     |    -     |
+		// |  Point.y |  Point.x | yx
+		// |    *     |    *     |
+		// | Tri[0].x | Tri[0].y ] < const
+		// |    +     |    +     |
+		// |  Point.y |  Point.x | yx
+		// |    *     |    *     |
+		// | Tri[1].x | Tri[2].y ] < const
+		// |    -     |    -     |
+		// |  Point.x |  Point.y | xy
+		// |    *     |    *     |
+		// | Tri[1].y | Tri[2].x ] < const
+		// |    +     |    +     |
+		// |  Det01   |  Det20   ] < const
+		// |    V     |    U     |
+		//
+		// V Utilizing all four lanes V
+		// !Four determinants at once!
+		// |  Point.y |  Point.x |  Point.x |  Point.y | yxxy
+		// |    *     |    *     |    *     |    *     | mul
+		// | Tri[1].x | Tri[0].y | Tri[2].y | Tri[0].x | < const
+		// |    -     |    -     |    -     |    -     | sub
+		// |  Point.x |  Point.y |  Point.y |  Point.x | xyyx
+		// |    *     |    *     |    *     |    *     | mul
+		// | Tri[1].y | Tri[0].x | Tri[2].x | Tri[0].y | < const
+		// |         hadd        |         hadd        | hadd
+		// |    +     |    +     |    +     |    +     | add
+		// [  Det01   |  Det20   |  Det01   |  Det20   ] < const
+		// |    V     |    U     |    V     |    U     |
+
+		__m128i VU = _mm_sub_epi32(
+			_mm_mullo_epi32(
+				PointYXXY,
+				ConstVec_1x0y2y0x //1x'0y'2y'0x
+			),
+			_mm_mullo_epi32(
+				PointXYYX,
+				ConstVec_1y0x2x0y //1y'0x'2x'0y
+			)
+		);
+		VU = _mm_add_epi32(
+			_mm_hadd_epi32(
+				VU, VU
+			),
+			Det0120
+		);
+		// Area = (blah) + Det20 + Det01
+		// U + V < Area ; U + V <= Area - 1
+		// U + V - Area < 0
+		// const auto AreaCheck = _mm_cmplt_epi32(
+		// 	_mm_hadd_epi32(
+		// 		VU, VU
+		// 	),
+		// 	Area
+		// );
+		// -U = U + (- 2 * U )
+		//                |_mm_unpacklo_epi32(0,sign(VU,(-1,-1,-1,-1)))| ( little waste)
+		// hadd[  ( V,U,V,U)     |      (0,-V,0,-U)      ]
+		// |    V+U   |    U+V   |   -V     |   -U     |
+		const __m128i CheckValues = _mm_hadd_epi32(
+			_mm_unpacklo_epi32(
+				_mm_sign_epi32(
+					VU,
+					_mm_set_epi32(-1,-1,-1,-1)
+				),
+				_mm_setzero_si128()
+			),
+			VU
+		);
+		// X <= Y;!( X > Y ); !( Y < X )
+		const __m128i CheckParallel = _mm_cmplt_epi32(
+			CheckConst,
+			CheckValues
+		);
+		const std::uint16_t Mask = ~_mm_movemask_epi8(CheckParallel);
+		Results[i] |= Mask == 0xFFFF;
+		// |    <=    |    <=    |   <=     |   <=     |
+		// | Area-1   | Area-1   |    0     |    0     | < const
+
+		// U = (blah) + Det20; U >= 0; U >= -Det20; -U <= Det20
+		// V = (blah) + Det01; V >= 0; V >= -Det01; -V <= Det01
+		// X >= 0 : !(X < 0)
+		// const auto SignCheck = _mm_cmplt_epi32(
+		// 	VU, _mm_setzero_si128()
+		// );
+
+		// const auto AreaSignCheck = _mm_andnot_si128(
+		// 	SignCheck, AreaCheck
+		// );
+		// Results[i] |= _mm_movemask_epi8(
+		// 	AreaSignCheck
+		// ) == 0xFFFF;
+	}
+}
+#endif
+
+//// Cross Product Edges
+
+#if defined(__SSE4_1__)
+// Edge functions of a convex polygon packed four edges to a register, in the
+// same lanes as the EdgeDirx and EdgeDiry registers of CrossProductMethod<0>,
+// for testing one point at a time against every edge
+// Lanes past the last edge are zero and always pass
+template<std::size_t N>
+struct ConvexEdges1
+{
+	static constexpr std::size_t Registers = (N + 3) / 4;
+	__m128i EdgeDirx[Registers], EdgeDiry[Registers], Vertx[Registers], Verty[Registers];
+
+	explicit ConvexEdges1(const ConvexPolygon<N>& Polygon)
+	{
+		alignas(16) std::int32_t Lanes[4][Registers * 4] = {};
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const glm::i32vec2 EdgeDir = Polygon[(Edge + 1) % N] - Polygon[Edge];
+			Lanes[0][Edge] = EdgeDir.x;
+			Lanes[1][Edge] = EdgeDir.y;
+			Lanes[2][Edge] = Polygon[Edge].x;
+			Lanes[3][Edge] = Polygon[Edge].y;
+		}
+		for( std::size_t i = 0; i < Registers; ++i )
+		{
+			EdgeDirx[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(&Lanes[0][i * 4]));
+			EdgeDiry[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(&Lanes[1][i * 4]));
+			Vertx[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(&Lanes[2][i * 4]));
+			Verty[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(&Lanes[3][i * 4]));
+		}
+	}
+
+	bool Covered(const glm::i32vec2& Point) const
+	{
+		const __m128i CurPoint = _mm_loadl_epi64(
+			reinterpret_cast<const __m128i*>(&Point)
+		);
+		const __m128i CurPointx = _mm_shuffle_epi32(
+			CurPoint, 0b00'00'00'00
+		);
+		const __m128i CurPointy = _mm_shuffle_epi32(
+			CurPoint, 0b01'01'01'01
+		);
+		// | EdgeDir[i+3].x | EdgeDir[i+2].x | EdgeDir[i+1].x | EdgeDir[i].x |
+		//                            |    mul    |
+		// |PointDir[i+3].y |PointDir[i+2].y |PointDir[i+1].y |PointDir[i].y |
+		//                            |    cmplt  |
+		// | EdgeDir[i+3].y | EdgeDir[i+2].y | EdgeDir[i+1].y | EdgeDir[i].y |
+		//                            |    mul    |
+		// |PointDir[i+3].x |PointDir[i+2].x |PointDir[i+1].x |PointDir[i].x |
+		__m128i Outside = _mm_setzero_si128();
+		for( std::size_t i = 0; i < Registers; ++i )
+		{
+			const __m128i DetHi = _mm_mullo_epi32(
+				EdgeDirx[i], _mm_sub_epi32(CurPointy, Verty[i])
+			);
+			const __m128i DetLo = _mm_mullo_epi32(
+				EdgeDiry[i], _mm_sub_epi32(CurPointx, Vertx[i])
+			);
+			Outside = _mm_or_si128(Outside, _mm_cmplt_epi32(DetHi, DetLo));
+		}
+		return _mm_testz_si128(Outside, Outside);
+	}
+};
+#endif
+
+#if defined(__AVX2__)
+// Edge functions of a convex polygon broadcast for testing eight points at a
+// time
+template<std::size_t N>
+struct ConvexEdges8
+{
+	__m256i EdgeDirx[N], EdgeDiry[N], Vertx[N], Verty[N];
+
+	explicit ConvexEdges8(const ConvexPolygon<N>& Polygon)
+	{
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const glm::i32vec2 EdgeDir = Polygon[(Edge + 1) % N] - Polygon[Edge];
+			EdgeDirx[Edge] = _mm256_set1_epi32(EdgeDir.x);
+			EdgeDiry[Edge] = _mm256_set1_epi32(EdgeDir.y);
+			Vertx[Edge] = _mm256_set1_epi32(Polygon[Edge].x);
+			Verty[Edge] = _mm256_set1_epi32(Polygon[Edge].y);
+		}
+	}
+
+	// Lanes are all set if that point is outside of the polygon
+	__m256i Outside(const glm::i32vec2 Points[]) const
+	{
+		// [ y3, y2, y1, y0, x3, x2, x1, x0 ]
+		const __m256i Deinterleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+		const __m256i Points0123 = _mm256_permutevar8x32_epi32(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Points)),
+			Deinterleave
+		);
+		const __m256i Points4567 = _mm256_permutevar8x32_epi32(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Points + 4)),
+			Deinterleave
+		);
+		const __m256i Pointx = _mm256_permute2x128_si256(
+			Points0123, Points4567, 0x20
+		);
+		const __m256i Pointy = _mm256_permute2x128_si256(
+			Points0123, Points4567, 0x31
+		);
+		// Any negative determinant puts the point outside
+		// The two products are compared rather than subtracted, the same as
+		// ConvexEdges1, so that vector bodies and serial tails agree on every
+		// point even past ConvexLimit
+		__m256i Outside = _mm256_setzero_si256();
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const __m256i DetHi = _mm256_mullo_epi32(
+				EdgeDirx[Edge], _mm256_sub_epi32(Pointy, Verty[Edge])
+			);
+			const __m256i DetLo = _mm256_mullo_epi32(
+				EdgeDiry[Edge], _mm256_sub_epi32(Pointx, Vertx[Edge])
+			);
+			Outside = _mm256_or_si256(Outside, _mm256_cmpgt_epi32(DetLo, DetHi));
+		}
+		return Outside;
+	}
+
+	// Bit i is set if Points[i] is covered
+	std::uint32_t Covered(const glm::i32vec2 Points[]) const
+	{
+		return ~_mm256_movemask_ps(
+			_mm256_castsi256_ps(Outside(Points))
+		) & 0xFF;
+	}
+};
+
+// Edge functions of a triangle broadcast for testing eight points at a time
+using CrossProductEdges8 = ConvexEdges8<3>;
+#endif
+
+#if defined(__AVX512F__)
+// Edge functions of a convex polygon broadcast for testing sixteen points at a
+// time
+template<std::size_t N>
+struct ConvexEdges16
+{
+	__m512i EdgeDirx[N], EdgeDiry[N], Vertx[N], Verty[N];
+
+	explicit ConvexEdges16(const ConvexPolygon<N>& Polygon)
+	{
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const glm::i32vec2 EdgeDir = Polygon[(Edge + 1) % N] - Polygon[Edge];
+			EdgeDirx[Edge] = _mm512_set1_epi32(EdgeDir.x);
+			EdgeDiry[Edge] = _mm512_set1_epi32(EdgeDir.y);
+			Vertx[Edge] = _mm512_set1_epi32(Polygon[Edge].x);
+			Verty[Edge] = _mm512_set1_epi32(Polygon[Edge].y);
+		}
+	}
+
+	// Bit i is set if Points[i] is covered
+	__mmask16 Covered(const glm::i32vec2 Points[]) const
+	{
+		// Even and odd elements across both loads
+		const __m512i Deinterleavex = _mm512_setr_epi32(
+			0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30
+		);
+		const __m512i Deinterleavey = _mm512_setr_epi32(
+			1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31
+		);
+		const __m512i Points0to7 = _mm512_loadu_si512(Points);
+		const __m512i Points8to15 = _mm512_loadu_si512(Points + 8);
+		const __m512i Pointx = _mm512_permutex2var_epi32(
+			Points0to7, Deinterleavex, Points8to15
+		);
+		const __m512i Pointy = _mm512_permutex2var_epi32(
+			Points0to7, Deinterleavey, Points8to15
+		);
+		// Products are compared rather than subtracted, as in ConvexEdges8
+		__mmask16 Mask = 0xFFFF;
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const __m512i DetHi = _mm512_mullo_epi32(
+				EdgeDirx[Edge], _mm512_sub_epi32(Pointy, Verty[Edge])
+			);
+			const __m512i DetLo = _mm512_mullo_epi32(
+				EdgeDiry[Edge], _mm512_sub_epi32(Pointx, Vertx[Edge])
+			);
+			Mask = _mm512_mask_cmpge_epi32_mask(Mask, DetHi, DetLo);
+		}
+		return Mask;
+	}
+};
+
+// Edge functions of a triangle broadcast for testing sixteen points at a time
+using CrossProductEdges16 = ConvexEdges16<3>;
+#endif
+
+//// Cross Product Compaction
+
+#if defined(__AVX2__)
+// Lane indices of each bit set in an 8-bit mask, packed into nibbles from
+// the lowest nibble up
+struct CompactTable
+{
+	std::uint32_t Permutes[256];
+	constexpr CompactTable() : Permutes()
+	{
+		for( std::uint32_t Mask = 0; Mask < 256; ++Mask )
+		{
+			std::uint32_t Packed = 0;
+			std::uint32_t Shift = 0;
+			for( std::uint32_t Lane = 0; Lane < 8; ++Lane )
+			{
+				if( Mask & (1u << Lane) )
+				{
+					Packed |= Lane << Shift;
+					Shift += 4;
+				}
+			}
+			Permutes[Mask] = Packed;
+		}
+	}
+};
+inline constexpr CompactTable CompactPermutes{};
+
+// Eight at a time
+template<>
+inline std::size_t CrossProductCompact<3>(
+	const glm::i32vec2 Points[], std::uint32_t Indices[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges8 Edges(Tri);
+	// Unpacks one nibble of a packed permute into each lane
+	const __m256i NibbleShift = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+	const __m256i NibbleMask = _mm256_set1_epi32(0xF);
+	__m256i Index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i IndexStep = _mm256_set1_epi32(8);
+
+	std::size_t i = 0;
+	std::size_t Written = 0;
+	for( ; i + 8 <= Count; i += 8 )
+	{
+		const std::uint32_t Mask = Edges.Covered(Points + i);
+		// Pack the covered indices to the bottom lanes
+		// The full register is stored, Written <= i keeps it within Indices
+		// and the next store overwrites the unused lanes
+		const __m256i Permute = _mm256_and_si256(
+			_mm256_srlv_epi32(
+				_mm256_set1_epi32(CompactPermutes.Permutes[Mask]), NibbleShift
+			),
+			NibbleMask
+		);
+		_mm256_storeu_si256(
+			reinterpret_cast<__m256i*>(Indices + Written),
+			_mm256_permutevar8x32_epi32(Index, Permute)
+		);
+		Written += _mm_popcnt_u32(Mask);
+		Index = _mm256_add_epi32(Index, IndexStep);
+	}
+	// Remainder, rebased onto the offset of the tail
+	const std::size_t Tail = CrossProductCompact<0>(
+		Points + i, Indices + Written, Count - i, Tri
+	);
+	for( std::size_t j = 0; j < Tail; ++j )
+	{
+		Indices[Written + j] += static_cast<std::uint32_t>(i);
+	}
+	return Written + Tail;
+}
+#endif
+
+#if defined(__AVX512F__)
+// Sixteen at a time
+template<>
+inline std::size_t CrossProductCompact<4>(
+	const glm::i32vec2 Points[], std::uint32_t Indices[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges16 Edges(Tri);
+	__m512i Index = _mm512_setr_epi32(
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+	);
+	const __m512i IndexStep = _mm512_set1_epi32(16);
+
+	std::size_t i = 0;
+	std::size_t Written = 0;
+	for( ; i + 16 <= Count; i += 16 )
+	{
+		const __mmask16 Mask = Edges.Covered(Points + i);
+		// Register compress followed by a full store, the memory form of
+		// vpcompressd is microcoded on some cores
+		_mm512_storeu_si512(
+			Indices + Written, _mm512_maskz_compress_epi32(Mask, Index)
+		);
+		Written += _mm_popcnt_u32(Mask);
+		Index = _mm512_add_epi32(Index, IndexStep);
+	}
+	// Remainder, rebased onto the offset of the tail
+	const std::size_t Tail = CrossProductCompact<3>(
+		Points + i, Indices + Written, Count - i, Tri
+	);
+	for( std::size_t j = 0; j < Tail; ++j )
+	{
+		Indices[Written + j] += static_cast<std::uint32_t>(i);
+	}
+	return Written + Tail;
+}
+#endif
+
+//// Cross Product Queries
+
+#if defined(__AVX2__)
+// Eight at a time
+template<>
+inline std::size_t CrossProductCount<3>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges8 Edges(Tri);
+	// Outside points are tallied per lane from their sign bits, keeping the
+	// loop free of any horizontal work
+	__m256i Outside = _mm256_setzero_si256();
+	std::size_t i = 0;
+	for( ; i + 8 <= Count; i += 8 )
+	{
+		Outside = _mm256_add_epi32(
+			Outside,
+			_mm256_srli_epi32(Edges.Outside(Points + i), 31)
+		);
+	}
+	// [ 7+3, 6+2, 5+1, 4+0 ]
+	__m128i Sum = _mm_add_epi32(
+		_mm256_castsi256_si128(Outside), _mm256_extracti128_si256(Outside, 1)
+	);
+	Sum = _mm_add_epi32(Sum, _mm_shuffle_epi32(Sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	Sum = _mm_add_epi32(Sum, _mm_shuffle_epi32(Sum, _MM_SHUFFLE(2, 3, 0, 1)));
+	return i - static_cast<std::uint32_t>(_mm_cvtsi128_si32(Sum))
+		+ CrossProductCount<0>(Points + i, Count - i, Tri);
+}
+
+template<>
+inline bool CrossProductAny<3>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges8 Edges(Tri);
+	std::size_t i = 0;
+	for( ; i + 8 <= Count; i += 8 )
+	{
+		if( Edges.Covered(Points + i) )
+		{
+			return true;
+		}
+	}
+	return CrossProductAny<0>(Points + i, Count - i, Tri);
+}
+#endif
+
+#if defined(__AVX512F__)
+// Sixteen at a time
+template<>
+inline std::size_t CrossProductCount<4>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges16 Edges(Tri);
+	// Mask registers popcount directly, without a movemask
+	std::size_t Covered = 0;
+	std::size_t i = 0;
+	for( ; i + 16 <= Count; i += 16 )
+	{
+		Covered += _mm_popcnt_u32(Edges.Covered(Points + i));
+	}
+	return Covered
+		+ CrossProductCount<3>(Points + i, Count - i, Tri);
+}
+
+template<>
+inline bool CrossProductAny<4>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const CrossProductEdges16 Edges(Tri);
+	std::size_t i = 0;
+	for( ; i + 16 <= Count; i += 16 )
+	{
+		if( Edges.Covered(Points + i) )
+		{
+			return true;
+		}
+	}
+	return CrossProductAny<3>(Points + i, Count - i, Tri);
+}
+#endif
+
+//// Cross Product Overwrite
+
+#if defined(__AVX2__)
+// Eight at a time, stored thirty-two at a time
+template<>
+inline void CrossProductWrite<3>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri, bool NonTemporal
+)
+{
+	const CrossProductEdges8 Edges(Tri);
+	// Serial up to a 32-byte aligned output for the streaming stores
+	std::size_t i = std::min<std::size_t>(
+		Count, -reinterpret_cast<std::uintptr_t>(Results) & 31
+	);
+	CrossProductWrite<0>(Points, Results, i, Tri, false);
+
+	// packs_epi32 and packs_epi16 interleave the four registers by lane
+	// | D4-7 | C4-7 | B4-7 | A4-7 | D0-3 | C0-3 | B0-3 | A0-3 |
+	// | D4-7 | D0-3 | C4-7 | C0-3 | B4-7 | B0-3 | A4-7 | A0-3 | < Unshuffle
+	const __m256i Unshuffle = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	const __m256i One = _mm256_set1_epi8(1);
+	for( ; i + 32 <= Count; i += 32 )
+	{
+		// Saturating packs keep the sign of each outside lane
+		const __m256i Outside = _mm256_permutevar8x32_epi32(
+			_mm256_packs_epi16(
+				_mm256_packs_epi32(
+					Edges.Outside(Points + i), Edges.Outside(Points + i + 8)
+				),
+				_mm256_packs_epi32(
+					Edges.Outside(Points + i + 16), Edges.Outside(Points + i + 24)
+				)
+			),
+			Unshuffle
+		);
+		// 1 where the sign is clear
+		const __m256i Coverage = _mm256_and_si256(
+			_mm256_cmpgt_epi8(Outside, _mm256_set1_epi8(-1)), One
+		);
+		__m256i* Store = reinterpret_cast<__m256i*>(Results + i);
+		if( NonTemporal )
+		{
+			_mm256_stream_si256(Store, Coverage);
+		}
+		else
+		{
+			_mm256_store_si256(Store, Coverage);
+		}
+	}
+	if( NonTemporal )
+	{
+		// Order the write-combined stores before any later store
+		_mm_sfence();
+	}
+	CrossProductWrite<0>(Points + i, Results + i, Count - i, Tri, false);
+}
+#endif
+
+//// Blending
+
+#if defined(__AVX2__)
+// Source-over of a premultiplied colour onto the pixels of Mask among eight
+// consecutive pixels, matching BlendOver exactly
+inline void BlendOver8(RGBA8 Pixels[], std::uint32_t Mask, const RGBA8& Colour)
+{
+	const __m256i Dst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pixels));
+	const __m256i Src = _mm256_set1_epi32(
+		static_cast<std::int32_t>(
+			std::uint32_t(Colour.R) | std::uint32_t(Colour.G) << 8
+			| std::uint32_t(Colour.B) << 16 | std::uint32_t(Colour.A) << 24
+		)
+	);
+	const __m256i InvAlpha = _mm256_set1_epi16(255 - Colour.A);
+	const __m256i Round = _mm256_set1_epi16(128);
+
+	// Channels widened to 16 bits, products stay within [0, 255 * 255]
+	// | ... | a1 b1 g1 r1 | a0 b0 g0 r0 | < unpacklo per 128-bit lane
+	__m256i Lo = _mm256_mullo_epi16(
+		_mm256_unpacklo_epi8(Dst, _mm256_setzero_si256()), InvAlpha
+	);
+	__m256i Hi = _mm256_mullo_epi16(
+		_mm256_unpackhi_epi8(Dst, _mm256_setzero_si256()), InvAlpha
+	);
+	// (x + 128 + ((x + 128) >> 8)) >> 8
+	Lo = _mm256_add_epi16(Lo, Round);
+	Hi = _mm256_add_epi16(Hi, Round);
+	Lo = _mm256_srli_epi16(_mm256_add_epi16(Lo, _mm256_srli_epi16(Lo, 8)), 8);
+	Hi = _mm256_srli_epi16(_mm256_add_epi16(Hi, _mm256_srli_epi16(Hi, 8)), 8);
+	// packus undoes the per-lane unpack
+	const __m256i Blended = _mm256_adds_epu8(_mm256_packus_epi16(Lo, Hi), Src);
+
+	// Lane i is all ones if pixel i is covered
+	const __m256i LaneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	const __m256i Covered = _mm256_cmpeq_epi32(
+		_mm256_and_si256(_mm256_set1_epi32(Mask), LaneBits), LaneBits
+	);
+	_mm256_storeu_si256(
+		reinterpret_cast<__m256i*>(Pixels),
+		_mm256_blendv_epi8(Dst, Blended, Covered)
+	);
+}
+#endif
+
+//// Visibility
+
+#if defined(__AVX2__)
+// Writes ID into each of the eight IDs where bit i of Mask is set, leaving
+// the others untouched in memory
+inline void WriteID8(std::uint32_t IDs[], std::uint32_t Mask, std::uint32_t ID)
+{
+	// Bit i of the mask moved into the sign bit of lane i
+	const __m256i Covered = _mm256_sllv_epi32(
+		_mm256_set1_epi32(static_cast<std::int32_t>(Mask)),
+		_mm256_setr_epi32(31, 30, 29, 28, 27, 26, 25, 24)
+	);
+	_mm256_maskstore_epi32(
+		reinterpret_cast<int*>(IDs), Covered,
+		_mm256_set1_epi32(static_cast<std::int32_t>(ID))
+	);
+}
+#endif
@@ -0,0 +1,903 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+#include "Types.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+// Fill kernels, exposed so that callers may instantiate them directly and have
+// them inlined into their own loops rather than calling through FillAlgorithms
+// Every kernel ORs the coverage of each point into Results
+//
+// CrossProductMethod<WidthExp2> and BarycentricMethod<WidthExp2> test
+// 2^WidthExp2 points per iteration and fall back to narrower specializations
+// when the instruction set does not provide one. CrossProductWidthExp2 and
+// BarycentricWidthExp2 name the widest specialization that was compiled.
+//
+// CrossProductCompact, CrossProductCount and CrossProductAny reduce coverage
+// to indices, a count or a single hit instead of writing Results, and widen
+// up to CrossProductCompactWidthExp2 and CrossProductQueryWidthExp2.
+// CrossProductWrite and CrossProductOverwrite store coverage rather than OR it
+// and widen up to CrossProductWriteWidthExp2.
+//
+// ConvexMethod<N> is the Cross-Product test over the N edges of a convex
+// polygon, eight points at a time with AVX2.
+
+namespace qTri
+{
+
+//// Cross Product Method
+
+template<std::uint8_t WidthExp2>
+inline void CrossProductMethod(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	CrossProductMethod<WidthExp2-1>(
+		Points, Results, Count,
+		Tri
+	);
+}
+
+//// Barycentric Method
+
+template<std::uint8_t WidthExp2>
+inline void BarycentricMethod(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	BarycentricMethod<WidthExp2-1>(
+		Points, Results, Count,
+		Tri
+	);
+}
+
+//// Cross Product Compaction
+
+// Writes the index of every point covered by Tri to Indices, in order, and
+// returns how many were written. Indices must hold Count entries.
+// Sparse coverage skips the bandwidth of a full Results array
+template<std::uint8_t WidthExp2>
+inline std::size_t CrossProductCompact(
+	const glm::i32vec2 Points[], std::uint32_t Indices[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	return CrossProductCompact<WidthExp2-1>(
+		Points, Indices, Count,
+		Tri
+	);
+}
+
+// Serial
+template<>
+inline std::size_t CrossProductCompact<0>(
+	const glm::i32vec2 Points[], std::uint32_t Indices[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+	std::size_t Written = 0;
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		// Branchless, the index is always stored and only kept when covered
+		Indices[Written] = static_cast<std::uint32_t>(i);
+		Written += (
+			(Det( EdgeDir[0], Points[i] - Tri[0] ) >= 0) &
+			(Det( EdgeDir[1], Points[i] - Tri[1] ) >= 0) &
+			(Det( EdgeDir[2], Points[i] - Tri[2] ) >= 0)
+		);
+	}
+	return Written;
+}
+
+//// Cross Product Queries
+
+// Number of points covered by Tri, without storing any coverage
+template<std::uint8_t WidthExp2>
+inline std::size_t CrossProductCount(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	return CrossProductCount<WidthExp2-1>(
+		Points, Count,
+		Tri
+	);
+}
+
+// Whether any point is covered by Tri, returning at the first covered block
+template<std::uint8_t WidthExp2>
+inline bool CrossProductAny(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	return CrossProductAny<WidthExp2-1>(
+		Points, Count,
+		Tri
+	);
+}
+
+// Serial
+template<>
+inline std::size_t CrossProductCount<0>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+	std::size_t Covered = 0;
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		Covered += (
+			(Det( EdgeDir[0], Points[i] - Tri[0] ) >= 0) &
+			(Det( EdgeDir[1], Points[i] - Tri[1] ) >= 0) &
+			(Det( EdgeDir[2], Points[i] - Tri[2] ) >= 0)
+		);
+	}
+	return Covered;
+}
+
+template<>
+inline bool CrossProductAny<0>(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		if(
+			Det( EdgeDir[0], Points[i] - Tri[0] ) >= 0 &&
+			Det( EdgeDir[1], Points[i] - Tri[1] ) >= 0 &&
+			Det( EdgeDir[2], Points[i] - Tri[2] ) >= 0
+		)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//// Cross Product Overwrite
+
+// Bytes of the last level cache, queried once
+std::size_t LastLevelCacheSize();
+
+// Stores the coverage of each point to Results rather than ORing into it, so
+// Results needs no clearing and is never read.
+// NonTemporal bypasses the cache on the way to memory, for outputs too large
+// to be read back before they are evicted
+template<std::uint8_t WidthExp2>
+inline void CrossProductWrite(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri, bool NonTemporal
+)
+{
+	CrossProductWrite<WidthExp2-1>(
+		Points, Results, Count,
+		Tri, NonTemporal
+	);
+}
+
+// Serial
+template<>
+inline void CrossProductWrite<0>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri, bool
+)
+{
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		Results[i] = (
+			(Det( EdgeDir[0], Points[i] - Tri[0] ) >= 0) &
+			(Det( EdgeDir[1], Points[i] - Tri[1] ) >= 0) &
+			(Det( EdgeDir[2], Points[i] - Tri[2] ) >= 0)
+		);
+	}
+}
+
+// Overwrites Results, streaming it past the cache once it outgrows the
+// last level cache
+template<std::uint8_t WidthExp2>
+inline void CrossProductOverwrite(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	CrossProductWrite<WidthExp2>(
+		Points, Results, Count,
+		Tri, Count >= LastLevelCacheSize()
+	);
+}
+
+//// Blending
+
+// x / 255 rounded to nearest, exact for x within [0, 255 * 255]
+inline std::uint32_t Div255(std::uint32_t x)
+{
+	x += 128;
+	return (x + (x >> 8)) >> 8;
+}
+
+// Source-over of a premultiplied colour, channels saturate should the colour
+// not be premultiplied
+inline RGBA8 BlendOver(const RGBA8& Dst, const RGBA8& Src)
+{
+	const std::uint32_t InvAlpha = 255 - Src.A;
+	const auto Channel = [InvAlpha](std::uint8_t DstChannel, std::uint8_t SrcChannel)
+	{
+		return static_cast<std::uint8_t>(
+			std::min<std::uint32_t>(255, SrcChannel + Div255(DstChannel * InvAlpha))
+		);
+	};
+	return RGBA8{
+		Channel(Dst.R, Src.R),
+		Channel(Dst.G, Src.G),
+		Channel(Dst.B, Src.B),
+		Channel(Dst.A, Src.A)
+	};
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include "Kernels-x86.hpp"
+#else
+// Widest specializations available
+constexpr std::uint8_t CrossProductWidthExp2 = 0;
+constexpr std::uint8_t BarycentricWidthExp2 = 0;
+constexpr std::uint8_t CrossProductCompactWidthExp2 = 0;
+constexpr const char* SerialISA = "Serial";
+constexpr const char* CrossProductISA = SerialISA;
+constexpr const char* BarycentricISA = SerialISA;
+constexpr const char* CrossProductCompactISA = SerialISA;
+constexpr std::uint8_t CrossProductQueryWidthExp2 = 0;
+constexpr const char* CrossProductQueryISA = SerialISA;
+constexpr std::uint8_t CrossProductWriteWidthExp2 = 0;
+constexpr const char* CrossProductWriteISA = SerialISA;
+
+template<>
+inline void CrossProductMethod<0>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	// Directional vectors along all three triangle edges
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		const glm::i32vec2 PointDir[3] = {
+			Points[i] - Tri[0],
+			Points[i] - Tri[1],
+			Points[i] - Tri[2]
+		};
+
+		const glm::i32vec3 Crosses = glm::vec3(
+			Det( EdgeDir[0], PointDir[0] ),
+			Det( EdgeDir[1], PointDir[1] ),
+			Det( EdgeDir[2], PointDir[2] )
+		);
+
+		Results[i] |= glm::all(
+			glm::greaterThanEqual(
+				Crosses,
+				glm::i32vec3(0)
+			)
+		);
+	}
+}
+
+template<>
+inline void BarycentricMethod<0>(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+)
+{
+	const std::int32_t Det01 = Det( Tri[0], Tri[1] );
+	const std::int32_t Det20 = Det( Tri[2], Tri[0] );
+	const std::int32_t Area  = Det( Tri[1], Tri[2] ) + Det20 + Det01;
+
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		const std::int32_t U = Det20
+			+ Det(    Tri[0], Points[i] )
+			+ Det( Points[i],    Tri[2] );
+		const std::int32_t V = Det01
+			+ Det(    Tri[1], Points[i] )
+			+ Det( Points[i],    Tri[0] );
+
+		Results[i] |= (U + V) < Area && U >= 0 && V >= 0;
+	}
+}
+
+// Edge functions of a convex polygon for testing one point at a time
+template<std::size_t N>
+struct ConvexEdges1
+{
+	ConvexPolygon<N> Polygon;
+	glm::i32vec2 EdgeDir[N];
+
+	explicit ConvexEdges1(const ConvexPolygon<N>& Polygon)
+		: Polygon(Polygon)
+	{
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			EdgeDir[Edge] = Polygon[(Edge + 1) % N] - Polygon[Edge];
+		}
+	}
+
+	bool Covered(const glm::i32vec2& Point) const
+	{
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			// Products compared rather than subtracted, as the vector edge tests do
+			const glm::i32vec2 PointDir = Point - Polygon[Edge];
+			if( EdgeDir[Edge].x * PointDir.y < EdgeDir[Edge].y * PointDir.x )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+#endif
+
+//// Visitors
+
+// Points per block handed to block visitors
+constexpr std::size_t VisitBlockWidth = 8;
+
+// Invokes Visitor(Index, Mask) for each block of up to VisitBlockWidth points
+// starting at Points[Index], where bit i of Mask is set if Points[Index + i]
+// is covered by Tri. Blocks that cover nothing are skipped.
+// The visitor runs while the coverage is still in registers, fusing the
+// caller's per-point work into the kernel rather than reading back Results
+template<typename VisitorT>
+inline void CrossProductVisitBlocks(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri, VisitorT&& Visitor
+)
+{
+	std::size_t i = 0;
+#if defined(__AVX2__)
+	const CrossProductEdges8 Edges(Tri);
+	for( ; i + VisitBlockWidth <= Count; i += VisitBlockWidth )
+	{
+		const std::uint32_t Mask = Edges.Covered(Points + i);
+		if( Mask )
+		{
+			Visitor(i, Mask);
+		}
+	}
+#endif
+	const glm::i32vec2 EdgeDir[3] = {
+		Tri[1] - Tri[0],
+		Tri[2] - Tri[1],
+		Tri[0] - Tri[2]
+	};
+	for( ; i < Count; i += VisitBlockWidth )
+	{
+		const std::size_t BlockCount = std::min(VisitBlockWidth, Count - i);
+		std::uint32_t Mask = 0;
+		for( std::size_t j = 0; j < BlockCount; ++j )
+		{
+			const glm::i32vec2& Point = Points[i + j];
+			Mask |= std::uint32_t(
+				Det( EdgeDir[0], Point - Tri[0] ) >= 0 &&
+				Det( EdgeDir[1], Point - Tri[1] ) >= 0 &&
+				Det( EdgeDir[2], Point - Tri[2] ) >= 0
+			) << j;
+		}
+		if( Mask )
+		{
+			Visitor(i, Mask);
+		}
+	}
+}
+
+// Invokes Visitor(Index) for every point covered by Tri
+template<typename VisitorT>
+inline void CrossProductVisit(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const Triangle& Tri, VisitorT&& Visitor
+)
+{
+	CrossProductVisitBlocks(
+		Points, Count, Tri,
+		[&Visitor](std::size_t Index, std::uint32_t Mask)
+		{
+			for( ; Mask; Mask &= Mask - 1 )
+			{
+				Visitor(Index + LowestBit(Mask));
+			}
+		}
+	);
+}
+
+//// Convex Polygons
+
+// ORs the coverage of each point by a convex polygon of N vertices into
+// Results, the Cross-Product test generalized from three edges to N
+// A quad or any other convex polygon is tested once per point rather than as
+// N - 2 triangles. Points on an edge are covered, so the coverage is the same
+// as that of the fan of triangles the polygon would otherwise be split into.
+// Coordinates must be within [-ConvexLimit, ConvexLimit]
+template<std::size_t N>
+inline void ConvexMethod(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const ConvexPolygon<N>& Polygon
+)
+{
+	static_assert(N >= 3, "A polygon needs at least three edges");
+	std::size_t i = 0;
+#if defined(__AVX2__)
+	const ConvexEdges8<N> Edges(Polygon);
+	const __m256i One = _mm256_set1_epi32(1);
+	for( ; i + 8 <= Count; i += 8 )
+	{
+		// 1 in each lane where the sign is clear
+		const __m256i Coverage = _mm256_xor_si256(
+			_mm256_srli_epi32(Edges.Outside(Points + i), 31), One
+		);
+		// Packed from eight dwords down to eight bytes
+		const __m128i Coverage16 = _mm_packs_epi32(
+			_mm256_castsi256_si128(Coverage), _mm256_extracti128_si256(Coverage, 1)
+		);
+		__m128i* const Result = reinterpret_cast<__m128i*>(Results + i);
+		_mm_storel_epi64(
+			Result,
+			_mm_or_si128(
+				_mm_loadl_epi64(Result), _mm_packus_epi16(Coverage16, Coverage16)
+			)
+		);
+	}
+#endif
+	const ConvexEdges1<N> SerialEdges(Polygon);
+	for( ; i < Count; ++i )
+	{
+		Results[i] |= SerialEdges.Covered(Points[i]);
+	}
+}
+
+// Invokes Visitor(Index, Mask) for each block of up to VisitBlockWidth points
+// covered by Polygon, the same as CrossProductVisitBlocks
+template<std::size_t N, typename VisitorT>
+inline void ConvexVisitBlocks(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const ConvexPolygon<N>& Polygon, VisitorT&& Visitor
+)
+{
+	static_assert(N >= 3, "A polygon needs at least three edges");
+	std::size_t i = 0;
+#if defined(__AVX2__)
+	const ConvexEdges8<N> Edges(Polygon);
+	for( ; i + VisitBlockWidth <= Count; i += VisitBlockWidth )
+	{
+		const std::uint32_t Mask = Edges.Covered(Points + i);
+		if( Mask )
+		{
+			Visitor(i, Mask);
+		}
+	}
+#endif
+	const ConvexEdges1<N> SerialEdges(Polygon);
+	for( ; i < Count; i += VisitBlockWidth )
+	{
+		const std::size_t BlockCount = std::min(VisitBlockWidth, Count - i);
+		std::uint32_t Mask = 0;
+		for( std::size_t j = 0; j < BlockCount; ++j )
+		{
+			Mask |= std::uint32_t(SerialEdges.Covered(Points[i + j])) << j;
+		}
+		if( Mask )
+		{
+			Visitor(i, Mask);
+		}
+	}
+}
+
+//// Views
+
+// Invokes RowFunction(y, x, RowPoints, Count) for each row of View that the
+// bounds of Polygon overlap, where RowPoints holds the coordinates of the
+// Count pixels of row y starting at pixel x
+template<typename PixelT, std::size_t N, typename RowFunctionT>
+inline void ForEachViewRow(
+	const BasicImageView<PixelT>& View, const ConvexPolygon<N>& Polygon,
+	RowFunctionT&& RowFunction
+)
+{
+	if( View.Width == 0 || View.Height == 0 )
+	{
+		return;
+	}
+	// Bounds of the polygon, relative to the view and clipped to it
+	glm::i32vec2 Min = Polygon[0];
+	glm::i32vec2 Max = Polygon[0];
+	for( const glm::i32vec2& CurVert : Polygon )
+	{
+		Min = glm::min(Min, CurVert);
+		Max = glm::max(Max, CurVert);
+	}
+	Min = glm::max(Min - View.Origin, glm::i32vec2(0));
+	Max = glm::min(
+		Max - View.Origin,
+		glm::i32vec2(View.Width - 1, View.Height - 1)
+	);
+	if( Min.x > Max.x || Min.y > Max.y )
+	{
+		return;
+	}
+
+	// One row of points, only the y coordinate changes between rows
+	PointBuffer RowPoints(Max.x - Min.x + 1);
+	for( std::size_t i = 0; i < RowPoints.size(); ++i )
+	{
+		RowPoints[i].x = View.Origin.x + Min.x + static_cast<std::int32_t>(i);
+	}
+	for( std::int32_t y = Min.y; y <= Max.y; ++y )
+	{
+		for( glm::i32vec2& CurPoint : RowPoints )
+		{
+			CurPoint.y = View.Origin.y + y;
+		}
+		RowFunction(y, Min.x, RowPoints.data(), RowPoints.size());
+	}
+}
+
+// Writes Value into every pixel of View covered by Tri in the view's own
+// pixel format, see PixelFormat
+// Coverage masks go straight from the Cross-Product test into the format
+// without an intermediate coverage array
+template<typename PixelT>
+inline void FillView(
+	const BasicImageView<PixelT>& View, const Triangle& Tri,
+	const PixelT& Value = PixelFormat<PixelT>::DefaultValue()
+)
+{
+	ForEachViewRow(
+		View, Tri,
+		[&](
+			std::size_t y, std::size_t x,
+			const glm::i32vec2 RowPoints[], std::size_t Count
+		)
+		{
+			PixelT* const Row = View.Row(y);
+			CrossProductVisitBlocks(
+				RowPoints, Count, Tri,
+				[&](std::size_t Index, std::uint32_t Mask)
+				{
+					PixelFormat<PixelT>::Write(Row, x + Index, Mask, Value);
+				}
+			);
+		}
+	);
+}
+
+// Writes Value into every pixel of View covered by a convex polygon of N
+// vertices, as FillView does for a triangle
+template<typename PixelT, std::size_t N>
+inline void FillView(
+	const BasicImageView<PixelT>& View, const ConvexPolygon<N>& Polygon,
+	const PixelT& Value = PixelFormat<PixelT>::DefaultValue()
+)
+{
+	ForEachViewRow(
+		View, Polygon,
+		[&](
+			std::size_t y, std::size_t x,
+			const glm::i32vec2 RowPoints[], std::size_t Count
+		)
+		{
+			PixelT* const Row = View.Row(y);
+			ConvexVisitBlocks(
+				RowPoints, Count, Polygon,
+				[&](std::size_t Index, std::uint32_t Mask)
+				{
+					PixelFormat<PixelT>::Write(Row, x + Index, Mask, Value);
+				}
+			);
+		}
+	);
+}
+
+// Composites the premultiplied Colour over every pixel of View covered by Tri
+// Blending is fused into the Cross-Product test, eight pixels at a time
+inline void BlendView(
+	const BasicImageView<RGBA8>& View, const Triangle& Tri, const RGBA8& Colour
+)
+{
+	ForEachViewRow(
+		View, Tri,
+		[&](
+			std::size_t y, std::size_t x,
+			const glm::i32vec2 RowPoints[], std::size_t Count
+		)
+		{
+			RGBA8* const Row = View.Row(y) + x;
+			CrossProductVisitBlocks(
+				RowPoints, Count, Tri,
+				[&](std::size_t Index, std::uint32_t Mask)
+				{
+#if defined(__AVX2__)
+					// Whole blocks are loaded and stored in full
+					if( Index + 8 <= Count )
+					{
+						BlendOver8(Row + Index, Mask, Colour);
+						return;
+					}
+#endif
+					for( ; Mask; Mask &= Mask - 1 )
+					{
+						RGBA8& CurPixel = Row[Index + LowestBit(Mask)];
+						CurPixel = BlendOver(CurPixel, Colour);
+					}
+				}
+			);
+		}
+	);
+}
+
+//// Visibility
+
+// ID of pixels in an ID buffer that no triangle covers
+constexpr std::uint32_t NoTriangle = 0xFFFFFFFF;
+
+// Writes FirstID + i into every pixel of View covered by Triangles[i]
+// Triangles are drawn in order and the last one covering a pixel wins,
+// uncovered pixels are left as they were, usually NoTriangle
+// See DepthVisibility for IDs resolved by depth instead
+inline void VisibilityView(
+	const BasicImageView<std::uint32_t>& View,
+	const Triangle Triangles[], std::size_t Count, std::uint32_t FirstID = 0
+)
+{
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		const Triangle& Tri = Triangles[i];
+		const std::uint32_t ID = FirstID + static_cast<std::uint32_t>(i);
+		ForEachViewRow(
+			View, Tri,
+			[&](
+				std::size_t y, std::size_t x,
+				const glm::i32vec2 RowPoints[], std::size_t RowCount
+			)
+			{
+				std::uint32_t* const Row = View.Row(y) + x;
+				CrossProductVisitBlocks(
+					RowPoints, RowCount, Tri,
+					[&](std::size_t Index, std::uint32_t Mask)
+					{
+#if defined(__AVX2__)
+						// Whole blocks are written with a single masked store
+						if( Index + 8 <= RowCount )
+						{
+							WriteID8(Row + Index, Mask, ID);
+							return;
+						}
+#endif
+						PixelFormat<std::uint32_t>::Write(Row, Index, Mask, ID);
+					}
+				);
+			}
+		);
+	}
+}
+
+//// Occlusion
+
+// Tracks the pixels of a view already claimed by opaque triangles, as one
+// 64-bit mask per 8x8 tile where bit (y * 8 + x) is pixel (x,y) of the tile
+// Tiles that are fully claimed are skipped without testing any points, and
+// triangles whose bounds only overlap such tiles are rejected outright
+class OcclusionTiles
+{
+public:
+	static constexpr std::size_t TileSize = 8;
+	static constexpr std::uint64_t Full = ~std::uint64_t(0);
+
+	OcclusionTiles(std::size_t Width, std::size_t Height)
+		: Width(Width),
+		Height(Height),
+		Tiles((Width + TileSize - 1) / TileSize, (Height + TileSize - 1) / TileSize)
+	{
+		Clear();
+	}
+
+	// Pixels past the width and height are claimed from the start so that
+	// tiles along the edges may become full
+	void Clear()
+	{
+		for( std::size_t TileY = 0; TileY < Tiles.Height; ++TileY )
+		{
+			for( std::size_t TileX = 0; TileX < Tiles.Width; ++TileX )
+			{
+				std::uint64_t Mask = Full;
+				for( std::size_t y = 0; y < TileSize; ++y )
+				{
+					for( std::size_t x = 0; x < TileSize; ++x )
+					{
+						if(
+							TileX * TileSize + x < Width
+							&& TileY * TileSize + y < Height
+						)
+						{
+							Mask &= ~(std::uint64_t(1) << (y * TileSize + x));
+						}
+					}
+				}
+				Tiles.Row(TileY)[TileX] = Mask;
+			}
+		}
+	}
+
+	std::uint64_t& Tile(std::size_t TileX, std::size_t TileY)
+	{
+		return Tiles.Row(TileY)[TileX];
+	}
+
+	std::size_t Width;
+	std::size_t Height;
+	BasicImage<std::uint64_t> Tiles;
+};
+
+// Writes the same IDs as VisibilityView into View for a batch of opaque
+// triangles, but visits them nearest first so that each pixel is written once
+// and the kernel never runs over tiles that nearer triangles already cover
+// Triangles are in back-to-front submission order, where the last one
+// covering a pixel wins, or front-to-back if FrontToBack is set, where the
+// first one wins
+// Occlusion must match the dimensions of View and carries between calls,
+// with each call landing behind all earlier ones
+// Returns the number of triangles rejected without testing any points
+inline std::size_t OpaqueVisibilityView(
+	const BasicImageView<std::uint32_t>& View, OcclusionTiles& Occlusion,
+	const Triangle Triangles[], std::size_t Count, std::uint32_t FirstID = 0,
+	bool FrontToBack = false
+)
+{
+	constexpr std::int32_t TileSize = OcclusionTiles::TileSize;
+	std::size_t Rejected = 0;
+	if( View.Width == 0 || View.Height == 0 )
+	{
+		return Rejected;
+	}
+	PointBuffer RowPoints;
+	for( std::size_t Order = 0; Order < Count; ++Order )
+	{
+		const std::size_t i = FrontToBack ? Order : Count - 1 - Order;
+		const Triangle& Tri = Triangles[i];
+		const std::uint32_t ID = FirstID + static_cast<std::uint32_t>(i);
+
+		// Bounds of the triangle, relative to the view and clipped to it
+		const glm::i32vec2 Min = glm::max(
+			glm::min(Tri[0], glm::min(Tri[1], Tri[2])) - View.Origin,
+			glm::i32vec2(0)
+		);
+		const glm::i32vec2 Max = glm::min(
+			glm::max(Tri[0], glm::max(Tri[1], Tri[2])) - View.Origin,
+			glm::i32vec2(View.Width - 1, View.Height - 1)
+		);
+		if( Min.x > Max.x || Min.y > Max.y )
+		{
+			continue;
+		}
+		const glm::i32vec2 MinTile = Min / TileSize;
+		const glm::i32vec2 MaxTile = Max / TileSize;
+
+		// Whole triangle, every tile of its bounds is already covered
+		bool Occluded = true;
+		for( std::int32_t TileY = MinTile.y; Occluded && TileY <= MaxTile.y; ++TileY )
+		{
+			for( std::int32_t TileX = MinTile.x; TileX <= MaxTile.x; ++TileX )
+			{
+				if( Occlusion.Tile(TileX, TileY) != OcclusionTiles::Full )
+				{
+					Occluded = false;
+					break;
+				}
+			}
+		}
+		if( Occluded )
+		{
+			++Rejected;
+			continue;
+		}
+
+		// Rows of points start on a tile so that each block of eight points
+		// is one row of a tile
+		const std::int32_t BeginX = MinTile.x * TileSize;
+		RowPoints.resize(Max.x + 1 - BeginX);
+		for( std::size_t j = 0; j < RowPoints.size(); ++j )
+		{
+			RowPoints[j].x = View.Origin.x + BeginX + static_cast<std::int32_t>(j);
+		}
+#if defined(__AVX2__)
+		const CrossProductEdges8 Edges(Tri);
+#endif
+		for( std::int32_t y = Min.y; y <= Max.y; ++y )
+		{
+			for( glm::i32vec2& CurPoint : RowPoints )
+			{
+				CurPoint.y = View.Origin.y + y;
+			}
+			std::uint32_t* const Row = View.Row(y) + BeginX;
+			const std::uint32_t RowShift = (y % TileSize) * TileSize;
+			for( std::size_t Block = 0; Block < RowPoints.size(); Block += TileSize )
+			{
+				std::uint64_t& CurTile = Occlusion.Tile(
+					(BeginX + Block) / TileSize, y / TileSize
+				);
+				const std::uint32_t Claimed = (CurTile >> RowShift) & 0xFF;
+				if( Claimed == 0xFF )
+				{
+					continue;
+				}
+				std::uint32_t Mask = 0;
+#if defined(__AVX2__)
+				if( Block + TileSize <= RowPoints.size() )
+				{
+					Mask = Edges.Covered(RowPoints.data() + Block);
+				}
+				else
+#endif
+				{
+					CrossProductVisitBlocks(
+						RowPoints.data() + Block,
+						std::min<std::size_t>(TileSize, RowPoints.size() - Block), Tri,
+						[&Mask](std::size_t, std::uint32_t BlockMask)
+						{
+							Mask = BlockMask;
+						}
+					);
+				}
+				Mask &= ~Claimed;
+				if( Mask == 0 )
+				{
+					continue;
+				}
+				CurTile |= std::uint64_t(Mask) << RowShift;
+#if defined(__AVX2__)
+				if( Block + TileSize <= RowPoints.size() )
+				{
+					WriteID8(Row + Block, Mask, ID);
+					continue;
+				}
+#endif
+				PixelFormat<std::uint32_t>::Write(Row, Block, Mask, ID);
+			}
+		}
+	}
+	return Rejected;
+}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <glm/fwd.hpp>
+#include <glm/vec2.hpp>
+
+namespace qTri
+{
+// Alignment of every buffer handed to the kernels, one cache line and the
+// widest vector register
+constexpr std::size_t BufferAlignment = 64;
+
+// Allocates from any std::pmr::memory_resource, always aligned to
+// BufferAlignment, so that arenas and pools may be plugged in per buffer
+// Defaults to the process-wide default resource
+template<typename T>
+class AlignedAllocator
+{
+public:
+	using value_type = T;
+
+	AlignedAllocator() noexcept
+		: Resource(std::pmr::get_default_resource())
+	{
+	}
+
+	AlignedAllocator(std::pmr::memory_resource* Resource) noexcept
+		: Resource(Resource)
+	{
+	}
+
+	template<typename U>
+	AlignedAllocator(const AlignedAllocator<U>& Other) noexcept
+		: Resource(Other.Resource)
+	{
+	}
+
+	T* allocate(std::size_t Count)
+	{
+		return static_cast<T*>(
+			Resource->allocate(Count * sizeof(T), BufferAlignment)
+		);
+	}
+
+	void deallocate(T* Pointer, std::size_t Count) noexcept
+	{
+		Resource->deallocate(Pointer, Count * sizeof(T), BufferAlignment);
+	}
+
+	template<typename U>
+	bool operator==(const AlignedAllocator<U>& Other) const noexcept
+	{
+		return Resource == Other.Resource || Resource->is_equal(*Other.Resource);
+	}
+
+	template<typename U>
+	bool operator!=(const AlignedAllocator<U>& Other) const noexcept
+	{
+		return !(*this == Other);
+	}
+
+	std::pmr::memory_resource* Resource;
+};
+
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+using PixelBuffer = AlignedVector<std::uint8_t>;
+using PointBuffer = AlignedVector<glm::i32vec2>;
+
+// Backs allocations of at least HugePageSize with huge pages where the system
+// provides them, cutting TLB misses across large frames
+// Smaller allocations are forwarded to Upstream
+class HugePageResource : public std::pmr::memory_resource
+{
+public:
+	static constexpr std::size_t HugePageSize = 2 << 20;
+
+	explicit HugePageResource(
+		std::pmr::memory_resource* Upstream = std::pmr::get_default_resource()
+	);
+
+private:
+	void* do_allocate(std::size_t Bytes, std::size_t Alignment) override;
+	void do_deallocate(void* Pointer, std::size_t Bytes, std::size_t Alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override;
+
+	std::pmr::memory_resource* Upstream;
+};
+
+// Shared instance over the default resource
+HugePageResource* HugePages();
+}
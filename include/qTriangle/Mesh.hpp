@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <tuple>
+
+#include "Types.hpp"
+
+namespace qTri
+{
+// Triangle mesh with edge adjacency
+// Faces follow the same winding as qTri::Triangle such that a point is
+// covered when Det(EdgeDir, PointDir) >= 0 for all three edges
+class Mesh
+{
+public:
+	static constexpr std::uint32_t NoFace = ~std::uint32_t(0);
+
+	Mesh(
+		std::vector<glm::i32vec2> Vertices,
+		std::vector<std::array<std::uint32_t,3>> Faces
+	);
+
+	Triangle GetTriangle(std::uint32_t Face) const
+	{
+		return Triangle{
+			{
+				Vertices[Faces[Face][0]],
+				Vertices[Faces[Face][1]],
+				Vertices[Faces[Face][2]]
+			}
+		};
+	}
+
+	std::vector<glm::i32vec2> Vertices;
+	// Vertex indices of each face
+	std::vector<std::array<std::uint32_t,3>> Faces;
+	// Adjacency[Face][i] is the face across the edge from Faces[Face][i] to
+	// Faces[Face][(i + 1) % 3], or NoFace along the border of the mesh
+	std::vector<std::array<std::uint32_t,3>> Adjacency;
+};
+
+// Visibility walk from StartFace towards the face that covers Point
+// Assumes a convex mesh, returns Mesh::NoFace once the walk leaves the border
+std::uint32_t Locate(
+	const Mesh& Surface, const glm::i32vec2& Point, std::uint32_t StartFace
+);
+
+// Locates a spatially coherent stream of points, each walk resuming from the
+// face of the previous point
+extern const std::vector<
+	std::pair<
+		void(* const)(
+			const Mesh& Surface,
+			const glm::i32vec2 Points[], std::uint32_t Faces[], std::size_t Count
+		),
+		const char*
+	>
+> LocateAlgorithms;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Types.hpp"
+
+namespace qTri
+{
+// Closed ring of vertices, the last vertex connects back to the first
+using Contour = std::vector<glm::i32vec2>;
+
+// Triangulates a simple polygon with holes by ear clipping
+// Outer bounds the polygon and each of Holes is cut out of it. Contours may
+// be wound either way and must not intersect themselves or each other.
+// Holes are joined to the outer contour by bridge edges first, so that the
+// whole polygon is clipped as a single ring.
+// The triangles do not overlap and are wound for the fill kernels, so their
+// coverage may simply be ORed together. A polygon of N vertices and H holes
+// produces N + 2H - 2 triangles, fewer where zero-area ears are dropped.
+std::vector<Triangle> Triangulate(
+	const Contour& Outer, const std::vector<Contour>& Holes = {}
+);
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "qTriangle.hpp"
+
+namespace qTri
+{
+// Rectangle of pixels from Min to Max, inclusive
+// Empty when Min is past Max along either axis
+struct Rect
+{
+	glm::i32vec2 Min;
+	glm::i32vec2 Max;
+
+	bool Empty() const
+	{
+		return Min.x > Max.x || Min.y > Max.y;
+	}
+};
+
+// Retained set of triangles rasterized into a coverage frame
+// Changing a triangle marks the union of its old and new bounds as dirty,
+// and Render only clears and re-rasterizes the dirty regions against the
+// triangles that overlap them, so that the cost of a frame follows the
+// amount of change rather than the size of the scene
+// Triangles are found through a grid of bins, each listing the triangles
+// whose bounds overlap it
+class Scene
+{
+public:
+	static constexpr std::int32_t BinSize = 32;
+
+	Scene(std::size_t Width, std::size_t Height, FillFunction Fill);
+
+	// Returns the ID of the new triangle
+	std::uint32_t Add(const Triangle& Tri);
+
+	void Update(std::uint32_t ID, const Triangle& Tri);
+
+	const Triangle& GetTriangle(std::uint32_t ID) const
+	{
+		return Triangles[ID];
+	}
+
+	std::size_t TriangleCount() const
+	{
+		return Triangles.size();
+	}
+
+	// Re-rasterizes every dirty region of the frame
+	// Returns the number of pixels that were re-rasterized
+	std::size_t Render();
+
+	const Image& Frame() const
+	{
+		return CurFrame;
+	}
+
+private:
+	// Bounds of a triangle, clipped to the frame
+	Rect Bounds(const Triangle& Tri) const;
+
+	// Adds or removes ID from every bin that Area overlaps
+	void Bin(std::uint32_t ID, const Rect& Area);
+	void Unbin(std::uint32_t ID, const Rect& Area);
+
+	void MarkDirty(const Rect& Area);
+
+	FillFunction Fill;
+	Image CurFrame;
+
+	std::vector<Triangle> Triangles;
+	std::vector<Rect> TriangleBounds;
+
+	std::size_t BinsX;
+	std::size_t BinsY;
+	std::vector<std::vector<std::uint32_t>> Bins;
+	// Render pass that last visited each triangle, so that triangles within
+	// several bins of a region are only drawn once
+	std::vector<std::uint32_t> Visited;
+	std::uint32_t CurPass = 0;
+
+	std::vector<Rect> Dirty;
+};
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+
+#include "qTriangle.hpp"
+
+namespace qTri
+{
+struct StreamStats
+{
+	std::size_t Points;
+	std::chrono::nanoseconds Duration;
+
+	double PointsPerSecond() const
+	{
+		return Points / std::chrono::duration<double>(Duration).count();
+	}
+	double BytesPerSecond() const
+	{
+		return PointsPerSecond() * sizeof(glm::i32vec2);
+	}
+};
+
+// Classifies a binary file of packed glm::i32vec2 records against a batch of
+// triangles and writes one coverage byte per record to OutputPath
+// Both files are memory mapped and processed in cache-sized chunks with
+// readahead hints so that paging in the input overlaps with the kernel
+// Returns false if either file could not be mapped
+bool ClassifyFile(
+	const char* InputPath, const char* OutputPath,
+	const Triangle Tris[], std::size_t TriCount,
+	FillFunction Fill,
+	StreamStats* Stats = nullptr
+);
+}
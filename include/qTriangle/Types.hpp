@@ -1,27 +1,283 @@
 #pragma once
+#include <algorithm>
 #include <tuple>
 #include <vector>
 #include <array>
+#include <cstdint>
 
 #include <glm/fwd.hpp>
 #include <glm/vec2.hpp>
 
+#include "Memory.hpp"
+
 namespace qTri
 {
-class Image
+// Index of the lowest set bit of a non-zero mask
+inline std::uint32_t LowestBit(std::uint32_t Mask)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz(Mask);
+#else
+	std::uint32_t Index = 0;
+	for( ; (Mask & 1) == 0; Mask >>= 1 )
+	{
+		++Index;
+	}
+	return Index;
+#endif
+}
+
+//// Pixel formats
+
+// Eight pixels of single bit coverage, the lowest bit is the leftmost pixel
+struct Bit8
+{
+	std::uint8_t Bits;
+};
+
+struct RGBA8
+{
+	std::uint8_t R, G, B, A;
+};
+
+// How each pixel format stores coverage
+// Write takes a block of up to eight pixels starting at pixel x of a row,
+// where bit i of Mask marks pixel x + i as covered
+//   std::uint8_t  : Covered pixels are set to Value, 0x01 by default as the
+//                   fill kernels write, or 0xFF for masks
+//   std::uint16_t : Value is added to covered pixels, counting overlaps
+//   float         : Covered pixels are set to Value, full coverage of 1.0
+//   RGBA8         : Covered pixels are set to the colour Value
+//   Bit8          : Covered bits are set, Value is unused
+template<typename PixelT>
+struct PixelFormat
+{
+	// Pixels held by each element of a row
+	static constexpr std::size_t PixelsPerElement = 1;
+
+	static PixelT DefaultValue();
+
+	static bool Covered(const PixelT Row[], std::size_t x)
+	{
+		return Row[x] != PixelT(0);
+	}
+
+	static void Write(
+		PixelT Row[], std::size_t x, std::uint32_t Mask, const PixelT& Value
+	)
+	{
+		for( ; Mask; Mask &= Mask - 1 )
+		{
+			Row[x + LowestBit(Mask)] = Value;
+		}
+	}
+};
+
+template<>
+inline std::uint8_t PixelFormat<std::uint8_t>::DefaultValue()
+{
+	return 1;
+}
+
+template<>
+inline float PixelFormat<float>::DefaultValue()
+{
+	return 1.0f;
+}
+
+template<>
+inline std::uint16_t PixelFormat<std::uint16_t>::DefaultValue()
+{
+	return 1;
+}
+
+template<>
+inline void PixelFormat<std::uint16_t>::Write(
+	std::uint16_t Row[], std::size_t x, std::uint32_t Mask,
+	const std::uint16_t& Value
+)
+{
+	for( ; Mask; Mask &= Mask - 1 )
+	{
+		Row[x + LowestBit(Mask)] += Value;
+	}
+}
+
+template<>
+struct PixelFormat<RGBA8>
+{
+	static constexpr std::size_t PixelsPerElement = 1;
+
+	static RGBA8 DefaultValue()
+	{
+		return RGBA8{0xFF, 0xFF, 0xFF, 0xFF};
+	}
+
+	static bool Covered(const RGBA8 Row[], std::size_t x)
+	{
+		return Row[x].A != 0;
+	}
+
+	static void Write(
+		RGBA8 Row[], std::size_t x, std::uint32_t Mask, const RGBA8& Value
+	)
+	{
+		for( ; Mask; Mask &= Mask - 1 )
+		{
+			Row[x + LowestBit(Mask)] = Value;
+		}
+	}
+};
+
+template<>
+struct PixelFormat<Bit8>
+{
+	static constexpr std::size_t PixelsPerElement = 8;
+
+	static Bit8 DefaultValue()
+	{
+		return Bit8{0xFF};
+	}
+
+	static bool Covered(const Bit8 Row[], std::size_t x)
+	{
+		return (Row[x / 8].Bits >> (x % 8)) & 1;
+	}
+
+	static void Write(
+		Bit8 Row[], std::size_t x, std::uint32_t Mask, const Bit8&
+	)
+	{
+		// Blocks that do not start on a whole element straddle two of them
+		const std::uint32_t Shifted = Mask << (x % 8);
+		Row[x / 8].Bits |= static_cast<std::uint8_t>(Shifted);
+		if( Shifted >> 8 )
+		{
+			Row[x / 8 + 1].Bits |= static_cast<std::uint8_t>(Shifted >> 8);
+		}
+	}
+};
+
+template<typename PixelT>
+class BasicImage
 {
 public:
-	Image(std::size_t Width, std::size_t Height)
+	using Format = PixelFormat<PixelT>;
+
+	// Strides are padded to a multiple of RowAlignment elements so that
+	// kernels may use aligned accesses and run past the end of a row into
+	// its padding
+	// Pixels come from Resource, aligned to BufferAlignment
+	BasicImage(
+		std::size_t Width, std::size_t Height,
+		std::size_t RowAlignment = 1,
+		std::pmr::memory_resource* Resource = std::pmr::get_default_resource()
+	)
 		: Width(Width),
-		Height(Height)
+		Height(Height),
+		Stride(
+			((Width + Format::PixelsPerElement - 1) / Format::PixelsPerElement
+				+ RowAlignment - 1) / RowAlignment * RowAlignment
+		),
+		Pixels(Stride * Height, AlignedAllocator<PixelT>(Resource))
+	{
+	}
+
+	PixelT* Row(std::size_t y)
+	{
+		return Pixels.data() + y * Stride;
+	}
+
+	const PixelT* Row(std::size_t y) const
+	{
+		return Pixels.data() + y * Stride;
+	}
+
+	std::size_t Width;
+	std::size_t Height;
+	// Elements between the start of consecutive rows
+	std::size_t Stride;
+	AlignedVector<PixelT> Pixels;
+};
+
+// Coverage of [0x00,0x01] from the fill kernels, or masks of [0x00,0xFF]
+using Image = BasicImage<std::uint8_t>;
+
+// A rectangle of pixels within a larger image, addressed in place
+// Origin is the coordinate that pixel (0,0) of the view stands for, so that
+// sub-views of a framebuffer keep its coordinate space while atlas tiles may
+// set their own
+template<typename PixelT>
+struct BasicImageView
+{
+	using Format = PixelFormat<PixelT>;
+
+	BasicImageView(
+		PixelT* Pixels,
+		std::size_t Width, std::size_t Height, std::size_t Stride,
+		glm::i32vec2 Origin = glm::i32vec2(0)
+	)
+		: Pixels(Pixels),
+		Width(Width),
+		Height(Height),
+		Stride(Stride),
+		Origin(Origin)
+	{
+	}
+
+	BasicImageView(BasicImage<PixelT>& Frame)
+		: BasicImageView(Frame.Pixels.data(), Frame.Width, Frame.Height, Frame.Stride)
 	{
-		Pixels.resize(Width * Height);
 	}
 
+	// Rectangle at (x,y) of this view, clipped to it
+	// Packed formats round x down to a whole element
+	BasicImageView SubView(
+		std::size_t x, std::size_t y, std::size_t SubWidth, std::size_t SubHeight
+	) const
+	{
+		x = std::min(x, Width) / Format::PixelsPerElement * Format::PixelsPerElement;
+		y = std::min(y, Height);
+		return BasicImageView(
+			Pixels + x / Format::PixelsPerElement + y * Stride,
+			std::min(SubWidth, Width - x), std::min(SubHeight, Height - y),
+			Stride,
+			Origin + glm::i32vec2(x, y)
+		);
+	}
+
+	PixelT* Row(std::size_t y) const
+	{
+		return Pixels + y * Stride;
+	}
+
+	PixelT* Pixels;
 	std::size_t Width;
 	std::size_t Height;
-	std::vector<std::uint8_t> Pixels;
+	// Elements between the start of consecutive rows
+	std::size_t Stride;
+	glm::i32vec2 Origin;
 };
 
+using ImageView = BasicImageView<std::uint8_t>;
+
 using Triangle = std::array<glm::i32vec2,3>;
+
+// Convex polygon of N vertices, wound the same way as a Triangle
+// ConvexPolygon<3> is a Triangle
+template<std::size_t N>
+using ConvexPolygon = std::array<glm::i32vec2,N>;
+
+// Largest coordinates of convex polygons and the points tested against them
+// Edge and point directions span 2L, (2L)^2 products must fit in 32 bits
+constexpr std::int32_t ConvexLimit = 23170;
+
+// Get Cross-Product Z component from two directional vectors
+inline std::int32_t Det(
+	const glm::i32vec2& Top,
+	const glm::i32vec2& Bottom
+)
+{
+	return Top.x * Bottom.y - Top.y * Bottom.x;
+}
 }
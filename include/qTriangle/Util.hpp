@@ -1,11 +1,46 @@
 #pragma once
+#include <cstdio>
+
+#include "Types.hpp"
 
 namespace qTri
 {
-class Image;
-
 namespace Util
 {
 void Draw(const qTri::Image& Frame);
+void Draw(const qTri::ImageView& View);
+
+// Any pixel format, drawing the pixels that hold coverage
+template<typename PixelT>
+void DrawPixels(
+	const PixelT* Pixels,
+	std::size_t Width, std::size_t Height, std::size_t Stride
+)
+{
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		std::fputs("\033[0;35m|\033[1;36m", stdout);
+		for( std::size_t x = 0; x < Width; ++x )
+		{
+			std::putchar(
+				" @"[PixelFormat<PixelT>::Covered(Pixels + y * Stride, x)]
+			);
+		}
+		std::fputs("\033[0;35m|\n", stdout);
+	}
+	std::fputs("\033[0m", stdout);
+}
+
+template<typename PixelT>
+void Draw(const qTri::BasicImageView<PixelT>& View)
+{
+	DrawPixels(View.Pixels, View.Width, View.Height, View.Stride);
+}
+
+template<typename PixelT>
+void Draw(const qTri::BasicImage<PixelT>& Frame)
+{
+	DrawPixels(Frame.Pixels.data(), Frame.Width, Frame.Height, Frame.Stride);
+}
 }
 }
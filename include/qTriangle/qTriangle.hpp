@@ -10,13 +10,33 @@
 
 namespace qTri
 {
-extern const std::vector<
-	std::pair<
-		void(* const)(
-			const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-			const Triangle& Tri
-		),
-		const char*
-	>
-> FillAlgorithms;
+using FillFunction = void(*)(
+	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
+	const Triangle& Tri
+);
+
+// A fill kernel and the capabilities it was built with
+struct FillKernel
+{
+	FillFunction Fill;
+	const char* Name;
+	// Instruction set the kernel was compiled for
+	const char* ISA;
+	// Points tested per iteration of the kernel
+	std::size_t Width;
+	// All coordinates must be within [-CoordinateLimit, CoordinateLimit]
+	// for the integer products of the kernel to not overflow
+	std::int32_t CoordinateLimit;
+	// Points that land exactly on any of the three edges are covered
+	// Half-open kernels leave out points on one of the edges
+	bool InclusiveEdges;
+};
+
+extern const std::vector<FillKernel> FillAlgorithms;
+
+// ORs the coverage of Tri into every pixel of View, with each pixel at its
+// coordinate relative to the view's Origin
+// Only the rows and columns of the triangle's bounds are visited
+// Kernels.hpp overloads FillView to write other pixel formats directly
+void FillView(const ImageView& View, const Triangle& Tri, FillFunction Fill);
 }
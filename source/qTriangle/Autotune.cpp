@@ -0,0 +1,193 @@
+#include <qTriangle/Autotune.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace qTri
+{
+// Upper bound of points in the synthetic workload
+constexpr std::size_t TunePoints = 1 << 20;
+// Point tests per kernel and repetition
+constexpr std::size_t TuneBudget = 1 << 22;
+constexpr std::size_t TuneRepetitions = 3;
+
+bool ISASupported(const char* ISA)
+{
+	if( std::strcmp(ISA, "Serial") == 0 )
+	{
+		return true;
+	}
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	if( std::strcmp(ISA, "SSE4.1") == 0 )
+	{
+		return __builtin_cpu_supports("sse4.1");
+	}
+	if( std::strcmp(ISA, "AVX2") == 0 )
+	{
+		return __builtin_cpu_supports("avx2");
+	}
+	if( std::strcmp(ISA, "AVX512F") == 0 )
+	{
+		return __builtin_cpu_supports("avx512f");
+	}
+#elif defined(_M_X64)
+	// Without a query, trust the instruction sets the kernels were built for
+	if(
+		std::strcmp(ISA, "SSE4.1") == 0 || std::strcmp(ISA, "AVX2") == 0
+		|| std::strcmp(ISA, "AVX512F") == 0
+	)
+	{
+		return true;
+	}
+#endif
+	return false;
+}
+
+std::vector<const FillKernel*> EligibleKernels(
+	const Workload& Shape, const std::vector<FillKernel>& Kernels
+)
+{
+	std::vector<const FillKernel*> Eligible;
+	for( const FillKernel& CurKernel : Kernels )
+	{
+		if(
+			ISASupported(CurKernel.ISA) &&
+			CurKernel.CoordinateLimit >= Shape.CoordinateLimit &&
+			(CurKernel.InclusiveEdges || !Shape.InclusiveEdges)
+		)
+		{
+			Eligible.push_back(&CurKernel);
+		}
+	}
+	return Eligible;
+}
+
+// Identifies a workload and the kernels that were compiled for it
+static std::string CacheKey(
+	const Workload& Shape, const std::vector<const FillKernel*>& Kernels
+)
+{
+	std::string Key = std::to_string(Shape.Width) + 'x'
+		+ std::to_string(Shape.Height) + '/'
+		+ std::to_string(Shape.TriangleSize) + '/'
+		+ std::to_string(Shape.CoordinateLimit) + '/'
+		+ (Shape.InclusiveEdges ? "Inclusive" : "HalfOpen");
+	for( const FillKernel* CurKernel : Kernels )
+	{
+		Key += '/';
+		Key += CurKernel->Name;
+		Key += ':';
+		Key += CurKernel->ISA;
+	}
+	return Key;
+}
+
+const FillKernel* Autotune(const Workload& Shape, const char* CachePath)
+{
+	const std::vector<const FillKernel*> Kernels = EligibleKernels(Shape);
+	if( Kernels.size() <= 1 )
+	{
+		return Kernels.empty() ? nullptr : Kernels.front();
+	}
+
+	// Cache lines are "Key Name"
+	const std::string Key = CacheKey(Shape, Kernels);
+	if( CachePath != nullptr )
+	{
+		std::ifstream Cache(CachePath);
+		for( std::string Line; std::getline(Cache, Line); )
+		{
+			const std::size_t Split = Line.rfind(' ');
+			if( Split == std::string::npos || Line.compare(0, Split, Key) != 0 )
+			{
+				continue;
+			}
+			for( const FillKernel* CurKernel : Kernels )
+			{
+				if( Line.compare(Split + 1, std::string::npos, CurKernel->Name) == 0 )
+				{
+					return CurKernel;
+				}
+			}
+		}
+	}
+
+	// Synthetic workload, the grid is clamped to keep tuning short
+	const std::size_t GridWidth = std::max<std::size_t>(
+		1, std::min(Shape.Width, TunePoints / std::max<std::size_t>(1, Shape.Height))
+	);
+	const std::size_t GridHeight = std::max<std::size_t>(
+		1, std::min(Shape.Height, TunePoints / GridWidth)
+	);
+	PointBuffer Points;
+	Points.reserve(GridWidth * GridHeight);
+	for( std::size_t y = 0; y < GridHeight; ++y )
+	{
+		for( std::size_t x = 0; x < GridWidth; ++x )
+		{
+			Points.emplace_back(x, y);
+		}
+	}
+	std::vector<std::uint8_t> Results(Points.size());
+
+	const std::size_t TriCount = std::clamp<std::size_t>(
+		TuneBudget / Points.size(), 4, 64
+	);
+	std::mt19937 RandomEngine(0x7154'A070);
+	std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth);
+	std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight);
+	std::uniform_int_distribution<std::int32_t> SizeDis(
+		0, static_cast<std::int32_t>(Shape.TriangleSize)
+	);
+	std::vector<Triangle> Tris(TriCount);
+	for( Triangle& CurTriangle : Tris )
+	{
+		const glm::i32vec2 Origin(WidthDis(RandomEngine), HeightDis(RandomEngine));
+		for( glm::i32vec2& CurVert : CurTriangle )
+		{
+			CurVert = Origin + glm::i32vec2(SizeDis(RandomEngine), SizeDis(RandomEngine));
+		}
+		// Wind the triangle such that the edges face inwards
+		if( Det(CurTriangle[1] - CurTriangle[0], CurTriangle[2] - CurTriangle[0]) < 0 )
+		{
+			std::swap(CurTriangle[1], CurTriangle[2]);
+		}
+	}
+
+	const FillKernel* Fastest = nullptr;
+	std::chrono::nanoseconds FastestTime = std::chrono::nanoseconds::max();
+	for( const FillKernel* CurKernel : Kernels )
+	{
+		// Warm up caches with one untimed pass, then keep the best repetition
+		for( std::size_t i = 0; i <= TuneRepetitions; ++i )
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			for( const Triangle& CurTriangle : Tris )
+			{
+				CurKernel->Fill(
+					Points.data(), Results.data(), Points.size(), CurTriangle
+				);
+			}
+			const auto Duration = std::chrono::steady_clock::now() - Start;
+			if( i != 0 && Duration < FastestTime )
+			{
+				FastestTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					Duration
+				);
+				Fastest = CurKernel;
+			}
+		}
+	}
+
+	if( CachePath != nullptr )
+	{
+		std::ofstream Cache(CachePath, std::ios::app);
+		Cache << Key << ' ' << Fastest->Name << '\n';
+	}
+	return Fastest;
+}
+}
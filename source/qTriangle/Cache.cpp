@@ -0,0 +1,135 @@
+#include <qTriangle/Cache.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace qTri
+{
+
+// Each bit of a byte widened into a byte of 0x00 or 0x01, lowest bit into
+// the lowest byte
+static constexpr std::array<std::uint64_t, 256> ExpandBits = []()
+{
+	std::array<std::uint64_t, 256> Table{};
+	for( std::size_t Bits = 0; Bits < 256; ++Bits )
+	{
+		for( std::size_t i = 0; i < 8; ++i )
+		{
+			Table[Bits] |= std::uint64_t((Bits >> i) & 1) << (i * 8);
+		}
+	}
+	return Table;
+}();
+
+std::size_t CoverageCache::KeyHash::operator()(const Key& Shape) const
+{
+	// FNV-1a over the coordinates
+	std::uint64_t Hash = 0xCBF29CE484222325;
+	for( const glm::i32vec2& CurVert : Shape )
+	{
+		for( const std::int32_t Coord : {CurVert.x, CurVert.y} )
+		{
+			Hash ^= static_cast<std::uint32_t>(Coord);
+			Hash *= 0x100000001B3;
+		}
+	}
+	return static_cast<std::size_t>(Hash);
+}
+
+CoverageCache::CoverageCache(std::size_t Capacity, FillFunction Fill)
+	: Capacity(std::max<std::size_t>(Capacity, 1)),
+	Fill(Fill)
+{
+	Index.reserve(this->Capacity);
+}
+
+void CoverageCache::FillView(const ImageView& View, const Triangle& Tri)
+{
+	const glm::i32vec2 Min = glm::min(Tri[0], glm::min(Tri[1], Tri[2]));
+	const glm::i32vec2 Max = glm::max(Tri[0], glm::max(Tri[1], Tri[2]));
+	const glm::i32vec2 Extent = Max - Min + glm::i32vec2(1);
+	if( Extent.x > MaxExtent || Extent.y > MaxExtent )
+	{
+		++CurStats.Bypasses;
+		qTri::FillView(View, Tri, Fill);
+		return;
+	}
+	// Bounds of the shape within the view, clipped to it
+	const glm::i32vec2 Offset = Min - View.Origin;
+	const glm::i32vec2 Begin = glm::max(-Offset, glm::i32vec2(0));
+	const glm::i32vec2 End = glm::min(
+		Extent,
+		glm::i32vec2(View.Width, View.Height) - Offset
+	);
+	if( Begin.x >= End.x || Begin.y >= End.y )
+	{
+		return;
+	}
+
+	const Key Shape = {{Tri[0] - Min, Tri[1] - Min, Tri[2] - Min}};
+	const auto Found = Index.find(Shape);
+	if( Found != Index.end() )
+	{
+		++CurStats.Hits;
+		Entries.splice(Entries.begin(), Entries, Found->second);
+	}
+	else
+	{
+		++CurStats.Misses;
+		if( Entries.size() == Capacity )
+		{
+			++CurStats.Evictions;
+			Index.erase(Entries.back().Shape);
+			Entries.pop_back();
+		}
+		// Rasterize the shape at the origin and pack it
+		Image Dense(Extent.x, Extent.y);
+		qTri::FillView(ImageView(Dense), Shape, Fill);
+		BasicImage<Bit8> Coverage(Extent.x, Extent.y);
+		for( std::size_t y = 0; y < Coverage.Height; ++y )
+		{
+			const std::uint8_t* const DenseRow = Dense.Row(y);
+			Bit8* const Row = Coverage.Row(y);
+			for( std::size_t x = 0; x < Coverage.Width; ++x )
+			{
+				Row[x / 8].Bits |= std::uint8_t((DenseRow[x] & 1) << (x % 8));
+			}
+		}
+		Entries.push_front(Entry{Shape, std::move(Coverage)});
+		Index.emplace(Shape, Entries.begin());
+	}
+
+	// Shift the packed coverage into place, eight pixels at a time where
+	// none of them are clipped
+	const BasicImage<Bit8>& Coverage = Entries.front().Coverage;
+	for( std::int32_t y = Begin.y; y < End.y; ++y )
+	{
+		const Bit8* const Row = Coverage.Row(y);
+		std::uint8_t* const Dst = View.Row(Offset.y + y);
+		for( std::int32_t x = Begin.x & ~7; x < End.x; x += 8 )
+		{
+			std::uint32_t Bits = Row[x / 8].Bits;
+			if( Bits == 0 )
+			{
+				continue;
+			}
+			if( x >= Begin.x && x + 8 <= End.x )
+			{
+				std::uint64_t Pixels;
+				std::memcpy(&Pixels, Dst + Offset.x + x, sizeof(Pixels));
+				Pixels |= ExpandBits[Bits];
+				std::memcpy(Dst + Offset.x + x, &Pixels, sizeof(Pixels));
+				continue;
+			}
+			for( ; Bits; Bits &= Bits - 1 )
+			{
+				const std::int32_t CurX = x + static_cast<std::int32_t>(LowestBit(Bits));
+				if( CurX >= Begin.x && CurX < End.x )
+				{
+					Dst[Offset.x + CurX] |= 1;
+				}
+			}
+		}
+	}
+}
+}
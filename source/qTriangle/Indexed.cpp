@@ -0,0 +1,241 @@
+#include <qTriangle/Indexed.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace qTri
+{
+
+static EdgeFunction MakeEdge(const glm::i32vec2& From, const glm::i32vec2& To)
+{
+	const std::int32_t A = From.y - To.y;
+	const std::int32_t B = To.x - From.x;
+	return EdgeFunction{A, B, -(A * From.x + B * From.y)};
+}
+
+static bool Degenerate(const std::array<std::uint32_t,3>& Face)
+{
+	return Face[0] == Face[1] || Face[1] == Face[2] || Face[2] == Face[0];
+}
+
+IndexedTriangles::IndexedTriangles(
+	std::vector<glm::i32vec2> Vertices,
+	std::vector<std::uint32_t> Indices,
+	Topology Primitive
+)
+	: Vertices(std::move(Vertices))
+{
+	const std::uint32_t Count = static_cast<std::uint32_t>(Indices.size());
+	const auto Vertex = [&](std::uint32_t Index) -> const glm::i32vec2&
+	{
+		return this->Vertices[Indices[Index]];
+	};
+	const auto AddFace = [&](
+		std::uint32_t V0, std::uint32_t V1, std::uint32_t V2,
+		std::uint32_t E0, std::uint32_t E1, std::uint32_t E2
+	)
+	{
+		const std::array<std::uint32_t,3> Face = {{Indices[V0], Indices[V1], Indices[V2]}};
+		if( !Degenerate(Face) )
+		{
+			Faces.push_back(Face);
+			FaceEdges.push_back({{E0, E1, E2}});
+		}
+	};
+
+	switch( Primitive )
+	{
+	case Topology::List:
+	{
+		// Undirected edge(Low << 32 | High) -> Edge from Low to High
+		std::unordered_map<std::uint64_t, std::uint32_t> Shared;
+		Shared.reserve(Count);
+		for( std::uint32_t i = 0; i + 3 <= Count; i += 3 )
+		{
+			std::array<std::uint32_t,3> CurEdges;
+			for( std::uint8_t j = 0; j < 3; ++j )
+			{
+				const std::uint32_t From = Indices[i + j];
+				const std::uint32_t To = Indices[i + (j + 1) % 3];
+				const std::uint64_t Low = std::min(From, To);
+				const std::uint64_t High = std::max(From, To);
+				const auto Found = Shared.emplace(
+					Low << 32 | High, static_cast<std::uint32_t>(Edges.size())
+				);
+				if( Found.second )
+				{
+					Edges.push_back(
+						MakeEdge(this->Vertices[Low], this->Vertices[High])
+					);
+				}
+				CurEdges[j] = Found.first->second << 1 | (From != Low);
+			}
+			AddFace(i, i + 1, i + 2, CurEdges[0], CurEdges[1], CurEdges[2]);
+		}
+		break;
+	}
+	case Topology::Strip:
+	{
+		if( Count < 3 )
+		{
+			break;
+		}
+		// Edges between neighbours, then edges that skip one index
+		//  Adjacent(j): j -> j + 1
+		//  Skip(j)    : j -> j + 2
+		const std::uint32_t SkipBase = Count - 1;
+		Edges.resize(SkipBase + Count - 2);
+		for( std::uint32_t j = 0; j + 1 < Count; ++j )
+		{
+			Edges[j] = MakeEdge(Vertex(j), Vertex(j + 1));
+		}
+		for( std::uint32_t j = 0; j + 2 < Count; ++j )
+		{
+			Edges[SkipBase + j] = MakeEdge(Vertex(j), Vertex(j + 2));
+		}
+		for( std::uint32_t k = 0; k + 2 < Count; ++k )
+		{
+			const std::uint32_t Adjacent0 = k << 1;
+			const std::uint32_t Adjacent1 = (k + 1) << 1;
+			const std::uint32_t Skip = (SkipBase + k) << 1;
+			if( k % 2 == 0 )
+			{
+				// k -> k + 1 -> k + 2 -> k
+				AddFace(k, k + 1, k + 2, Adjacent0, Adjacent1, Skip | 1);
+			}
+			else
+			{
+				// k + 1 -> k -> k + 2 -> k + 1
+				AddFace(k + 1, k, k + 2, Adjacent0 | 1, Skip, Adjacent1 | 1);
+			}
+		}
+		break;
+	}
+	case Topology::Fan:
+	{
+		if( Count < 3 )
+		{
+			break;
+		}
+		// Edges from the center, then edges along the rim
+		//  Spoke(j): 0 -> j
+		//  Rim(j)  : j -> j + 1
+		const std::uint32_t RimBase = Count - 1;
+		Edges.resize(RimBase + Count - 2);
+		for( std::uint32_t j = 1; j < Count; ++j )
+		{
+			Edges[j - 1] = MakeEdge(Vertex(0), Vertex(j));
+		}
+		for( std::uint32_t j = 1; j + 1 < Count; ++j )
+		{
+			Edges[RimBase + j - 1] = MakeEdge(Vertex(j), Vertex(j + 1));
+		}
+		for( std::uint32_t k = 1; k + 1 < Count; ++k )
+		{
+			// 0 -> k -> k + 1 -> 0
+			AddFace(
+				0, k, k + 1,
+				(k - 1) << 1, (RimBase + k - 1) << 1, (k << 1) | 1
+			);
+		}
+		break;
+	}
+	}
+}
+
+void FillView(const ImageView& View, const IndexedTriangles& Mesh)
+{
+	if( View.Width == 0 || View.Height == 0 )
+	{
+		return;
+	}
+	for( std::size_t Face = 0; Face < Mesh.Faces.size(); ++Face )
+	{
+		EdgeFunction Edge[3];
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const std::uint32_t Ref = Mesh.FaceEdges[Face][i];
+			Edge[i] = Mesh.Edges[Ref >> 1];
+			if( Ref & 1 )
+			{
+				Edge[i] = EdgeFunction{-Edge[i].A, -Edge[i].B, -Edge[i].C};
+			}
+		}
+
+		// Bounds of the triangle, relative to the view and clipped to it
+		const Triangle Tri = Mesh.GetTriangle(Face);
+		const glm::i32vec2 Min = glm::max(
+			glm::min(Tri[0], glm::min(Tri[1], Tri[2])) - View.Origin,
+			glm::i32vec2(0)
+		);
+		const glm::i32vec2 Max = glm::min(
+			glm::max(Tri[0], glm::max(Tri[1], Tri[2])) - View.Origin,
+			glm::i32vec2(View.Width - 1, View.Height - 1)
+		);
+		if( Min.x > Max.x || Min.y > Max.y )
+		{
+			continue;
+		}
+
+		for( std::int32_t y = Min.y; y <= Max.y; ++y )
+		{
+			std::uint8_t* const Row = View.Row(y);
+			const glm::i32vec2 Point = View.Origin + glm::i32vec2(Min.x, y);
+			std::int32_t RowEdge[3];
+			for( std::uint8_t i = 0; i < 3; ++i )
+			{
+				RowEdge[i] = Edge[i].A * Point.x + Edge[i].B * Point.y + Edge[i].C;
+			}
+			std::int32_t x = Min.x;
+#if defined(__AVX2__)
+			// Each edge function steps by A along the row
+			const __m256i Lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+			__m256i Edges[3];
+			__m256i Steps[3];
+			for( std::uint8_t i = 0; i < 3; ++i )
+			{
+				Edges[i] = _mm256_add_epi32(
+					_mm256_set1_epi32(RowEdge[i]),
+					_mm256_mullo_epi32(_mm256_set1_epi32(Edge[i].A), Lanes)
+				);
+				Steps[i] = _mm256_set1_epi32(Edge[i].A * 8);
+			}
+			for( ; x + 8 <= Max.x + 1; x += 8 )
+			{
+				// Sign bits of any negative edge function
+				const __m256i Outside = _mm256_or_si256(
+					_mm256_or_si256(Edges[0], Edges[1]), Edges[2]
+				);
+				std::uint32_t Mask = ~_mm256_movemask_ps(
+					_mm256_castsi256_ps(Outside)
+				) & 0xFF;
+				for( ; Mask; Mask &= Mask - 1 )
+				{
+					Row[x + LowestBit(Mask)] |= 1;
+				}
+				for( std::uint8_t i = 0; i < 3; ++i )
+				{
+					Edges[i] = _mm256_add_epi32(Edges[i], Steps[i]);
+				}
+			}
+			for( std::uint8_t i = 0; i < 3; ++i )
+			{
+				RowEdge[i] += Edge[i].A * (x - Min.x);
+			}
+#endif
+			for( ; x <= Max.x; ++x )
+			{
+				Row[x] |= (RowEdge[0] | RowEdge[1] | RowEdge[2]) >= 0;
+				for( std::uint8_t i = 0; i < 3; ++i )
+				{
+					RowEdge[i] += Edge[i].A;
+				}
+			}
+		}
+	}
+}
+}
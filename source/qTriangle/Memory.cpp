@@ -0,0 +1,103 @@
+#include <qTriangle/Memory.hpp>
+
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace qTri
+{
+HugePageResource::HugePageResource(std::pmr::memory_resource* Upstream)
+	: Upstream(Upstream)
+{
+}
+
+#if defined(__linux__)
+
+void* HugePageResource::do_allocate(std::size_t Bytes, std::size_t Alignment)
+{
+	if( Bytes < HugePageSize || Alignment > HugePageSize )
+	{
+		return Upstream->allocate(Bytes, Alignment);
+	}
+	// Mappings are page aligned, rounding up to whole huge pages lets the
+	// kernel back all of it with huge pages
+	const std::size_t MapSize = (Bytes + HugePageSize - 1) & ~(HugePageSize - 1);
+	void* Pointer = mmap(
+		nullptr, MapSize, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0
+	);
+	if( Pointer == MAP_FAILED )
+	{
+		// No reserved huge pages, ask for transparent huge pages instead
+		// These mappings are only page aligned, so map an extra huge page
+		// and trim the head and tail such that the kernel may back every
+		// huge page of it
+		const std::size_t PaddedSize = MapSize + HugePageSize;
+		Pointer = mmap(
+			nullptr, PaddedSize, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+		);
+		if( Pointer == MAP_FAILED )
+		{
+			throw std::bad_alloc();
+		}
+		std::uint8_t* Mapped = static_cast<std::uint8_t*>(Pointer);
+		const std::size_t Head = -reinterpret_cast<std::uintptr_t>(Mapped)
+			& (HugePageSize - 1);
+		if( Head )
+		{
+			munmap(Mapped, Head);
+		}
+		munmap(Mapped + Head + MapSize, HugePageSize - Head);
+		Pointer = Mapped + Head;
+		madvise(Pointer, MapSize, MADV_HUGEPAGE);
+	}
+	return Pointer;
+}
+
+void HugePageResource::do_deallocate(
+	void* Pointer, std::size_t Bytes, std::size_t Alignment
+)
+{
+	if( Bytes < HugePageSize || Alignment > HugePageSize )
+	{
+		Upstream->deallocate(Pointer, Bytes, Alignment);
+		return;
+	}
+	const std::size_t MapSize = (Bytes + HugePageSize - 1) & ~(HugePageSize - 1);
+	munmap(Pointer, MapSize);
+}
+
+#else
+
+void* HugePageResource::do_allocate(std::size_t Bytes, std::size_t Alignment)
+{
+	// Huge pages are only requested on Linux
+	return Upstream->allocate(Bytes, Alignment);
+}
+
+void HugePageResource::do_deallocate(
+	void* Pointer, std::size_t Bytes, std::size_t Alignment
+)
+{
+	Upstream->deallocate(Pointer, Bytes, Alignment);
+}
+
+#endif
+
+bool HugePageResource::do_is_equal(
+	const std::pmr::memory_resource& Other
+) const noexcept
+{
+	return this == &Other;
+}
+
+HugePageResource* HugePages()
+{
+	static HugePageResource Resource;
+	return &Resource;
+}
+}
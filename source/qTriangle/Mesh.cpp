@@ -0,0 +1,331 @@
+#include <qTriangle/Mesh.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+namespace qTri
+{
+
+Mesh::Mesh(
+	std::vector<glm::i32vec2> Vertices,
+	std::vector<std::array<std::uint32_t,3>> Faces
+)
+	: Vertices(std::move(Vertices)),
+	Faces(std::move(Faces))
+{
+	// Directed edge(From << 32 | To) -> Face
+	std::unordered_map<std::uint64_t, std::uint32_t> Edges;
+	Edges.reserve(this->Faces.size() * 3);
+	for( std::uint32_t Face = 0; Face < this->Faces.size(); ++Face )
+	{
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const std::uint64_t From = this->Faces[Face][i];
+			const std::uint64_t To   = this->Faces[Face][(i + 1) % 3];
+			Edges[From << 32 | To] = Face;
+		}
+	}
+
+	// The neighboring face walks the same edge in the opposite direction
+	Adjacency.resize(this->Faces.size());
+	for( std::uint32_t Face = 0; Face < this->Faces.size(); ++Face )
+	{
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const std::uint64_t From = this->Faces[Face][i];
+			const std::uint64_t To   = this->Faces[Face][(i + 1) % 3];
+			const auto Twin = Edges.find(To << 32 | From);
+			Adjacency[Face][i] = Twin == Edges.end() ? NoFace : Twin->second;
+		}
+	}
+}
+
+std::uint32_t Locate(
+	const Mesh& Surface, const glm::i32vec2& Point, std::uint32_t StartFace
+)
+{
+	std::uint32_t CurFace = StartFace;
+	// Visibility walks may cycle on non-Delaunay meshes, the first tested
+	// edge is rotated each step to break out of them and a walk that
+	// still visits more steps than there are faces falls back to a scan
+	for( std::size_t Step = 0; Step < Surface.Faces.size(); ++Step )
+	{
+		const Triangle Tri = Surface.GetTriangle(CurFace);
+		std::uint8_t Exit = 3;
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const std::uint8_t Edge = (Step + i) % 3;
+			if(
+				Det(
+					Tri[(Edge + 1) % 3] - Tri[Edge],
+					Point - Tri[Edge]
+				) < 0
+			)
+			{
+				Exit = Edge;
+				break;
+			}
+		}
+		if( Exit == 3 )
+		{
+			return CurFace;
+		}
+		CurFace = Surface.Adjacency[CurFace][Exit];
+		if( CurFace == Mesh::NoFace )
+		{
+			return Mesh::NoFace;
+		}
+	}
+
+	for( std::uint32_t Face = 0; Face < Surface.Faces.size(); ++Face )
+	{
+		const Triangle Tri = Surface.GetTriangle(Face);
+		if(
+			Det( Tri[1] - Tri[0], Point - Tri[0] ) >= 0 &&
+			Det( Tri[2] - Tri[1], Point - Tri[1] ) >= 0 &&
+			Det( Tri[0] - Tri[2], Point - Tri[2] ) >= 0
+		)
+		{
+			return Face;
+		}
+	}
+	return Mesh::NoFace;
+}
+
+//// Visibility walk
+
+template<std::uint8_t WidthExp2>
+inline void WalkMethod(
+	const Mesh& Surface,
+	const glm::i32vec2 Points[], std::uint32_t Faces[], std::size_t Count
+)
+{
+	WalkMethod<WidthExp2-1>(
+		Surface, Points, Faces, Count
+	);
+}
+
+// Serial
+template<>
+inline void WalkMethod<0>(
+	const Mesh& Surface,
+	const glm::i32vec2 Points[], std::uint32_t Faces[], std::size_t Count
+)
+{
+	std::uint32_t CurFace = 0;
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		Faces[i] = Locate(Surface, Points[i], CurFace);
+		// Points that land outside keep walking from the last hit
+		CurFace = Faces[i] == Mesh::NoFace ? CurFace : Faces[i];
+	}
+}
+
+#if defined(__AVX2__)
+
+// Eight walkers at a time
+// The stream is split into eight coherent sub-streams that each get their own
+// walker. Every step gathers the current face of all eight walkers, tests the
+// point against all three edges and either retires the point or steps across
+// the first failing edge.
+template<>
+inline void WalkMethod<3>(
+	const Mesh& Surface,
+	const glm::i32vec2 Points[], std::uint32_t Faces[], std::size_t Count
+)
+{
+	// Gathers use 32-bit indices
+	constexpr std::size_t BlockSize = std::size_t(1) << 30;
+	if( Count > BlockSize )
+	{
+		for( std::size_t i = 0; i < Count; i += BlockSize )
+		{
+			WalkMethod<3>(
+				Surface, Points + i, Faces + i, std::min(BlockSize, Count - i)
+			);
+		}
+		return;
+	}
+
+	const std::int32_t Span = static_cast<std::int32_t>(Count / 8);
+	if( Span == 0 )
+	{
+		WalkMethod<0>(
+			Surface, Points, Faces, Count
+		);
+		return;
+	}
+
+	const int* FaceIndices = reinterpret_cast<const int*>(
+		Surface.Faces.data()
+	);
+	const int* Adjacency = reinterpret_cast<const int*>(
+		Surface.Adjacency.data()
+	);
+	const int* Vertices = reinterpret_cast<const int*>(
+		Surface.Vertices.data()
+	);
+	const int* PointCoords = reinterpret_cast<const int*>(Points);
+
+	const __m256i Zero = _mm256_setzero_si256();
+	const __m256i One = _mm256_set1_epi32(1);
+	const __m256i Ones = _mm256_cmpeq_epi32(Zero, Zero);
+	const __m256i Three = _mm256_set1_epi32(3);
+	const __m256i StepLimit = _mm256_set1_epi32(
+		static_cast<std::int32_t>(Surface.Faces.size())
+	);
+
+	// Index of the current point of each walker
+	__m256i Cursor = _mm256_mullo_epi32(
+		_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+		_mm256_set1_epi32(Span)
+	);
+	const __m256i End = _mm256_add_epi32(Cursor, _mm256_set1_epi32(Span));
+	__m256i CurFace = Zero;
+	__m256i Steps = Zero;
+	__m256i Active = Ones;
+
+	for( std::uint32_t Step = 0; !_mm256_testz_si256(Active, Active); ++Step )
+	{
+		const __m256i Pointx = _mm256_mask_i32gather_epi32(
+			Zero, PointCoords + 0, Cursor, Active, 8
+		);
+		const __m256i Pointy = _mm256_mask_i32gather_epi32(
+			Zero, PointCoords + 1, Cursor, Active, 8
+		);
+
+		const __m256i FaceBase = _mm256_mullo_epi32(CurFace, Three);
+		__m256i Vertx[3], Verty[3];
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const __m256i VertIdx = _mm256_mask_i32gather_epi32(
+				Zero, FaceIndices + i, FaceBase, Active, 4
+			);
+			Vertx[i] = _mm256_mask_i32gather_epi32(
+				Zero, Vertices + 0, VertIdx, Active, 8
+			);
+			Verty[i] = _mm256_mask_i32gather_epi32(
+				Zero, Vertices + 1, VertIdx, Active, 8
+			);
+		}
+
+		// Outside[i] = Det(EdgeDir[i], PointDir[i]) < 0
+		//            = EdgeDir.y * PointDir.x > EdgeDir.x * PointDir.y
+		__m256i Outside[3];
+		for( std::uint8_t i = 0; i < 3; ++i )
+		{
+			const std::uint8_t Next = (i + 1) % 3;
+			const __m256i DetHi = _mm256_mullo_epi32(
+				_mm256_sub_epi32(Vertx[Next], Vertx[i]),
+				_mm256_sub_epi32(Pointy, Verty[i])
+			);
+			const __m256i DetLo = _mm256_mullo_epi32(
+				_mm256_sub_epi32(Verty[Next], Verty[i]),
+				_mm256_sub_epi32(Pointx, Vertx[i])
+			);
+			Outside[i] = _mm256_cmpgt_epi32(DetLo, DetHi);
+		}
+		const __m256i Walking = _mm256_and_si256(
+			Active,
+			_mm256_or_si256(
+				_mm256_or_si256(Outside[0], Outside[1]), Outside[2]
+			)
+		);
+		const __m256i Inside = _mm256_andnot_si256(Walking, Active);
+
+		// Exit through the first failing edge, starting from a rotating edge
+		// Blending in reverse priority lets the highest priority edge win
+		__m256i Exit = Zero;
+		for( std::uint8_t i = 3; i-- > 0; )
+		{
+			const std::uint8_t Edge = (Step + i) % 3;
+			Exit = _mm256_blendv_epi8(
+				Exit, _mm256_set1_epi32(Edge), Outside[Edge]
+			);
+		}
+		const __m256i NextFace = _mm256_mask_i32gather_epi32(
+			CurFace, Adjacency, _mm256_add_epi32(FaceBase, Exit), Walking, 4
+		);
+		const __m256i Border = _mm256_and_si256(
+			Walking, _mm256_cmpeq_epi32(NextFace, Ones)
+		);
+		Steps = _mm256_and_si256(
+			_mm256_add_epi32(Steps, One), Walking
+		);
+		const __m256i Stuck = _mm256_and_si256(
+			Walking,
+			_mm256_cmpgt_epi32(Steps, StepLimit)
+		);
+		// Walkers that leave the border stay on their last face
+		CurFace = _mm256_blendv_epi8(NextFace, CurFace, Border);
+
+		const __m256i Retired = _mm256_or_si256(
+			_mm256_or_si256(Inside, Border), Stuck
+		);
+		std::uint32_t RetiredMask = _mm256_movemask_ps(
+			_mm256_castsi256_ps(Retired)
+		);
+		if( RetiredMask == 0 )
+		{
+			continue;
+		}
+
+		alignas(32) std::uint32_t CursorLanes[8];
+		alignas(32) std::uint32_t FaceLanes[8];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(CursorLanes), Cursor);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(FaceLanes), CurFace);
+		const std::uint32_t InsideMask = _mm256_movemask_ps(
+			_mm256_castsi256_ps(Inside)
+		);
+		const std::uint32_t StuckMask = _mm256_movemask_ps(
+			_mm256_castsi256_ps(Stuck)
+		);
+		for( ; RetiredMask; RetiredMask &= RetiredMask - 1 )
+		{
+			const std::uint8_t Lane = _tzcnt_u32(RetiredMask);
+			const std::uint32_t PointIdx = CursorLanes[Lane];
+			if( InsideMask & (1u << Lane) )
+			{
+				Faces[PointIdx] = FaceLanes[Lane];
+			}
+			else if( StuckMask & (1u << Lane) )
+			{
+				Faces[PointIdx] = Locate(
+					Surface, Points[PointIdx], FaceLanes[Lane]
+				);
+			}
+			else
+			{
+				Faces[PointIdx] = Mesh::NoFace;
+			}
+		}
+		Cursor = _mm256_sub_epi32(Cursor, Retired);
+		Steps = _mm256_andnot_si256(Retired, Steps);
+		Active = _mm256_cmpgt_epi32(End, Cursor);
+	}
+
+	WalkMethod<0>(
+		Surface, Points + Span * 8, Faces + Span * 8, Count - Span * 8
+	);
+}
+#endif
+
+//// Exports
+
+const std::vector<
+	std::pair<
+		void(* const)(
+			const Mesh& Surface,
+			const glm::i32vec2 Points[], std::uint32_t Faces[], std::size_t Count
+		),
+		const char*
+	>
+> LocateAlgorithms = {
+	{WalkMethod<0>,	"Serial-Walk"},
+	{WalkMethod<3>,	"WalkMethod"},
+};
+}
@@ -0,0 +1,324 @@
+#include <qTriangle/Polygon.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace qTri
+{
+
+// Det(B - A, C - A) in 64 bits, positive when A, B, C are wound like
+// qTri::Triangle
+static std::int64_t Cross(
+	const glm::i32vec2& A, const glm::i32vec2& B, const glm::i32vec2& C
+)
+{
+	return std::int64_t(B.x - A.x) * (C.y - A.y)
+		- std::int64_t(B.y - A.y) * (C.x - A.x);
+}
+
+// Twice the signed area, positive for the winding of qTri::Triangle
+static std::int64_t SignedArea(const Contour& Ring)
+{
+	std::int64_t Area = 0;
+	for( std::size_t i = 0; i < Ring.size(); ++i )
+	{
+		const glm::i32vec2& A = Ring[i];
+		const glm::i32vec2& B = Ring[(i + 1) % Ring.size()];
+		Area += std::int64_t(A.x) * B.y - std::int64_t(A.y) * B.x;
+	}
+	return Area;
+}
+
+// Drops repeated consecutive vertices, including a last vertex that repeats
+// the first, and winds the contour positively or negatively
+static Contour Normalize(const Contour& Ring, bool Positive)
+{
+	Contour Result;
+	Result.reserve(Ring.size());
+	for( const glm::i32vec2& CurVert : Ring )
+	{
+		if( Result.empty() || Result.back() != CurVert )
+		{
+			Result.push_back(CurVert);
+		}
+	}
+	while( Result.size() > 1 && Result.back() == Result.front() )
+	{
+		Result.pop_back();
+	}
+	if( (SignedArea(Result) > 0) != Positive )
+	{
+		std::reverse(Result.begin(), Result.end());
+	}
+	return Result;
+}
+
+// Joins a negatively wound hole to the ring through a bridge edge from the
+// hole's rightmost vertex to a vertex of the ring that it can see
+// The ring then walks in along the bridge, around the hole and back out
+// Returns false if no part of the ring is to the right of the hole
+static bool Bridge(Contour& Ring, const Contour& Hole)
+{
+	const std::size_t HoleStart = std::max_element(
+		Hole.begin(), Hole.end(),
+		[](const glm::i32vec2& A, const glm::i32vec2& B)
+		{
+			return A.x < B.x;
+		}
+	) - Hole.begin();
+	const glm::i32vec2 M = Hole[HoleStart];
+
+	// Nearest edge of the ring crossed by a ray to the right of M
+	double NearestX = std::numeric_limits<double>::infinity();
+	std::size_t Edge = Ring.size();
+	for( std::size_t i = 0; i < Ring.size(); ++i )
+	{
+		const glm::i32vec2& A = Ring[i];
+		const glm::i32vec2& B = Ring[(i + 1) % Ring.size()];
+		if( (A.y > M.y) == (B.y > M.y) )
+		{
+			continue;
+		}
+		const double X = A.x + double(M.y - A.y) * (B.x - A.x) / (B.y - A.y);
+		if( X >= M.x && X < NearestX )
+		{
+			NearestX = X;
+			Edge = i;
+		}
+	}
+	if( Edge == Ring.size() )
+	{
+		return false;
+	}
+
+	// The rightmost end of the crossed edge is visible unless a vertex of
+	// the ring lies within the triangle between M, the crossing and that
+	// end, in which case the one closest in angle to the ray is visible
+	std::size_t Visible = Ring[Edge].x > Ring[(Edge + 1) % Ring.size()].x
+		? Edge : (Edge + 1) % Ring.size();
+	const glm::i32vec2 P = Ring[Visible];
+	if( P.y != M.y || P.x != NearestX )
+	{
+		// Both sides of the ray as seen from M, through P and the crossing
+		const double Side = P.y < M.y ? -1.0 : 1.0;
+		double BestSlope = std::numeric_limits<double>::infinity();
+		double BestX = std::numeric_limits<double>::infinity();
+		for( std::size_t i = 0; i < Ring.size(); ++i )
+		{
+			const glm::i32vec2& V = Ring[i];
+			if( V.x <= M.x || V == P || (V.y - M.y) * Side < 0 )
+			{
+				continue;
+			}
+			// Within the span between the ray and the segment from M to P,
+			// and before the edge that was crossed
+			const double Slope = (V.y - M.y) * Side / double(V.x - M.x);
+			const double PSlope = (P.y - M.y) * Side / double(P.x - M.x);
+			const glm::i32vec2& A = Ring[Edge];
+			const glm::i32vec2& B = Ring[(Edge + 1) % Ring.size()];
+			const double EdgeSide = (double(B.x) - A.x) * (V.y - A.y)
+				- (double(B.y) - A.y) * (V.x - A.x);
+			const double MSide = (double(B.x) - A.x) * (M.y - A.y)
+				- (double(B.y) - A.y) * (M.x - A.x);
+			if( Slope > PSlope || EdgeSide * MSide < 0 )
+			{
+				continue;
+			}
+			if( Slope < BestSlope || (Slope == BestSlope && V.x < BestX) )
+			{
+				BestSlope = Slope;
+				BestX = V.x;
+				Visible = i;
+			}
+		}
+	}
+
+	// Vertices repeated by earlier bridges appear once on either side of
+	// them, the bridge must leave from the copy whose corner faces M
+	const glm::i32vec2 Target = Ring[Visible];
+	for( std::size_t i = 0; i < Ring.size(); ++i )
+	{
+		if( Ring[i] != Target )
+		{
+			continue;
+		}
+		const glm::i32vec2& Before = Ring[(i + Ring.size() - 1) % Ring.size()];
+		const glm::i32vec2& After = Ring[(i + 1) % Ring.size()];
+		const bool Convex = Cross(Before, Target, After) >= 0;
+		const bool Facing = Convex
+			? Cross(Before, Target, M) >= 0 && Cross(Target, After, M) >= 0
+			: Cross(Before, Target, M) >= 0 || Cross(Target, After, M) >= 0;
+		if( Facing )
+		{
+			Visible = i;
+			break;
+		}
+	}
+
+	// ..., P, M, rest of the hole, M, P, ...
+	Contour Joined;
+	Joined.reserve(Ring.size() + Hole.size() + 2);
+	Joined.insert(Joined.end(), Ring.begin(), Ring.begin() + Visible + 1);
+	for( std::size_t i = 0; i <= Hole.size(); ++i )
+	{
+		Joined.push_back(Hole[(HoleStart + i) % Hole.size()]);
+	}
+	Joined.insert(Joined.end(), Ring.begin() + Visible, Ring.end());
+	Ring = std::move(Joined);
+	return true;
+}
+
+std::vector<Triangle> Triangulate(
+	const Contour& Outer, const std::vector<Contour>& Holes
+)
+{
+	Contour Ring = Normalize(Outer, true);
+	if( Ring.size() < 3 )
+	{
+		return {};
+	}
+
+	// Holes furthest to the right are bridged first so that the bridges of
+	// later holes may land on them without crossing
+	std::vector<Contour> Inner;
+	for( const Contour& CurHole : Holes )
+	{
+		Contour CurInner = Normalize(CurHole, false);
+		if( CurInner.size() >= 3 )
+		{
+			Inner.push_back(std::move(CurInner));
+		}
+	}
+	const auto MaxX = [](const Contour& Ring)
+	{
+		return std::max_element(
+			Ring.begin(), Ring.end(),
+			[](const glm::i32vec2& A, const glm::i32vec2& B)
+			{
+				return A.x < B.x;
+			}
+		)->x;
+	};
+	std::sort(
+		Inner.begin(), Inner.end(),
+		[&MaxX](const Contour& A, const Contour& B)
+		{
+			return MaxX(A) > MaxX(B);
+		}
+	);
+	for( const Contour& CurHole : Inner )
+	{
+		Bridge(Ring, CurHole);
+	}
+
+	// Ring as a doubly linked list that ears are unlinked from
+	const std::uint32_t Count = static_cast<std::uint32_t>(Ring.size());
+	std::vector<std::uint32_t> Prev(Count);
+	std::vector<std::uint32_t> Next(Count);
+	for( std::uint32_t i = 0; i < Count; ++i )
+	{
+		Prev[i] = (i + Count - 1) % Count;
+		Next[i] = (i + 1) % Count;
+	}
+	const auto Unlink = [&](std::uint32_t Vert)
+	{
+		Next[Prev[Vert]] = Next[Vert];
+		Prev[Next[Vert]] = Prev[Vert];
+	};
+
+	// A convex corner that no other remaining vertex lies within
+	// Vertices that repeat a corner, from bridges, do not block it
+	const auto IsEar = [&](std::uint32_t Vert) -> bool
+	{
+		const glm::i32vec2& A = Ring[Prev[Vert]];
+		const glm::i32vec2& B = Ring[Vert];
+		const glm::i32vec2& C = Ring[Next[Vert]];
+		if( Cross(A, B, C) <= 0 )
+		{
+			return false;
+		}
+		const glm::i32vec2 Min = glm::min(A, glm::min(B, C));
+		const glm::i32vec2 Max = glm::max(A, glm::max(B, C));
+		for( std::uint32_t i = Next[Next[Vert]]; i != Prev[Vert]; i = Next[i] )
+		{
+			const glm::i32vec2& P = Ring[i];
+			if(
+				P.x < Min.x || P.y < Min.y || P.x > Max.x || P.y > Max.y
+				|| P == A || P == B || P == C
+			)
+			{
+				continue;
+			}
+			if( Cross(A, B, P) >= 0 && Cross(B, C, P) >= 0 && Cross(C, A, P) >= 0 )
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	std::vector<Triangle> Triangles;
+	Triangles.reserve(Count - 2);
+	const auto Clip = [&](std::uint32_t Vert)
+	{
+		const Triangle Ear = {{Ring[Prev[Vert]], Ring[Vert], Ring[Next[Vert]]}};
+		if( Cross(Ear[0], Ear[1], Ear[2]) > 0 )
+		{
+			Triangles.push_back(Ear);
+		}
+		Unlink(Vert);
+	};
+
+	std::uint32_t Remaining = Count;
+	std::uint32_t Cur = 0;
+	std::uint32_t Stalled = 0;
+	while( Remaining > 3 )
+	{
+		if( IsEar(Cur) )
+		{
+			const std::uint32_t Following = Next[Cur];
+			Clip(Cur);
+			--Remaining;
+			Cur = Following;
+			Stalled = 0;
+			continue;
+		}
+		Cur = Next[Cur];
+		if( ++Stalled < Remaining )
+		{
+			continue;
+		}
+		// A whole pass without an ear, from collinear or touching vertices
+		// Drop a zero-area corner, or else clip any convex one
+		std::uint32_t Forced = Count;
+		std::uint32_t i = Cur;
+		do
+		{
+			const std::int64_t Area = Cross(Ring[Prev[i]], Ring[i], Ring[Next[i]]);
+			if( Area == 0 )
+			{
+				Forced = i;
+				break;
+			}
+			if( Area > 0 && Forced == Count )
+			{
+				Forced = i;
+			}
+			i = Next[i];
+		} while( i != Cur );
+		if( Forced == Count )
+		{
+			break;
+		}
+		Cur = Next[Forced];
+		Clip(Forced);
+		--Remaining;
+		Stalled = 0;
+	}
+	if( Remaining == 3 )
+	{
+		Clip(Cur);
+	}
+	return Triangles;
+}
+}
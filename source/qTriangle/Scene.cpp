@@ -0,0 +1,179 @@
+#include <qTriangle/Scene.hpp>
+
+#include <algorithm>
+
+namespace qTri
+{
+
+static bool Intersects(const Rect& A, const Rect& B)
+{
+	return A.Min.x <= B.Max.x && B.Min.x <= A.Max.x
+		&& A.Min.y <= B.Max.y && B.Min.y <= A.Max.y;
+}
+
+static Rect Union(const Rect& A, const Rect& B)
+{
+	return Rect{glm::min(A.Min, B.Min), glm::max(A.Max, B.Max)};
+}
+
+Scene::Scene(std::size_t Width, std::size_t Height, FillFunction Fill)
+	: Fill(Fill),
+	CurFrame(Width, Height),
+	BinsX((Width + BinSize - 1) / BinSize),
+	BinsY((Height + BinSize - 1) / BinSize),
+	Bins(BinsX * BinsY)
+{
+}
+
+std::uint32_t Scene::Add(const Triangle& Tri)
+{
+	const std::uint32_t ID = static_cast<std::uint32_t>(Triangles.size());
+	Triangles.push_back(Tri);
+	TriangleBounds.push_back(Bounds(Tri));
+	Visited.push_back(CurPass);
+	Bin(ID, TriangleBounds[ID]);
+	MarkDirty(TriangleBounds[ID]);
+	return ID;
+}
+
+void Scene::Update(std::uint32_t ID, const Triangle& Tri)
+{
+	const Rect Previous = TriangleBounds[ID];
+	const Rect Next = Bounds(Tri);
+	Triangles[ID] = Tri;
+	TriangleBounds[ID] = Next;
+	Unbin(ID, Previous);
+	Bin(ID, Next);
+	// Both where the triangle was and where it is now
+	if( !Previous.Empty() && !Next.Empty() && Intersects(Previous, Next) )
+	{
+		MarkDirty(Union(Previous, Next));
+	}
+	else
+	{
+		MarkDirty(Previous);
+		MarkDirty(Next);
+	}
+}
+
+std::size_t Scene::Render()
+{
+	// Overlapping regions are merged so that no pixel is rasterized twice
+	for( bool Merged = true; Merged; )
+	{
+		Merged = false;
+		for( std::size_t i = 0; i < Dirty.size(); ++i )
+		{
+			for( std::size_t j = i + 1; j < Dirty.size(); )
+			{
+				if( Intersects(Dirty[i], Dirty[j]) )
+				{
+					Dirty[i] = Union(Dirty[i], Dirty[j]);
+					Dirty[j] = Dirty.back();
+					Dirty.pop_back();
+					Merged = true;
+				}
+				else
+				{
+					++j;
+				}
+			}
+		}
+	}
+
+	std::size_t Pixels = 0;
+	const ImageView FrameView(CurFrame);
+	for( const Rect& Region : Dirty )
+	{
+		const glm::i32vec2 Extent = Region.Max - Region.Min + glm::i32vec2(1);
+		const ImageView RegionView = FrameView.SubView(
+			Region.Min.x, Region.Min.y, Extent.x, Extent.y
+		);
+		for( std::size_t y = 0; y < RegionView.Height; ++y )
+		{
+			std::fill_n(RegionView.Row(y), RegionView.Width, 0);
+		}
+		// Every triangle overlapping the region, each drawn once
+		++CurPass;
+		for( std::int32_t BinY = Region.Min.y / BinSize; BinY <= Region.Max.y / BinSize; ++BinY )
+		{
+			for( std::int32_t BinX = Region.Min.x / BinSize; BinX <= Region.Max.x / BinSize; ++BinX )
+			{
+				for( const std::uint32_t ID : Bins[BinX + BinY * BinsX] )
+				{
+					if( Visited[ID] == CurPass )
+					{
+						continue;
+					}
+					Visited[ID] = CurPass;
+					if( Intersects(TriangleBounds[ID], Region) )
+					{
+						FillView(RegionView, Triangles[ID], Fill);
+					}
+				}
+			}
+		}
+		Pixels += RegionView.Width * RegionView.Height;
+	}
+	Dirty.clear();
+	return Pixels;
+}
+
+Rect Scene::Bounds(const Triangle& Tri) const
+{
+	if( CurFrame.Width == 0 || CurFrame.Height == 0 )
+	{
+		return Rect{glm::i32vec2(0), glm::i32vec2(-1)};
+	}
+	return Rect{
+		glm::max(
+			glm::min(Tri[0], glm::min(Tri[1], Tri[2])), glm::i32vec2(0)
+		),
+		glm::min(
+			glm::max(Tri[0], glm::max(Tri[1], Tri[2])),
+			glm::i32vec2(CurFrame.Width - 1, CurFrame.Height - 1)
+		)
+	};
+}
+
+void Scene::Bin(std::uint32_t ID, const Rect& Area)
+{
+	if( Area.Empty() )
+	{
+		return;
+	}
+	for( std::int32_t BinY = Area.Min.y / BinSize; BinY <= Area.Max.y / BinSize; ++BinY )
+	{
+		for( std::int32_t BinX = Area.Min.x / BinSize; BinX <= Area.Max.x / BinSize; ++BinX )
+		{
+			Bins[BinX + BinY * BinsX].push_back(ID);
+		}
+	}
+}
+
+void Scene::Unbin(std::uint32_t ID, const Rect& Area)
+{
+	if( Area.Empty() )
+	{
+		return;
+	}
+	for( std::int32_t BinY = Area.Min.y / BinSize; BinY <= Area.Max.y / BinSize; ++BinY )
+	{
+		for( std::int32_t BinX = Area.Min.x / BinSize; BinX <= Area.Max.x / BinSize; ++BinX )
+		{
+			std::vector<std::uint32_t>& CurBin = Bins[BinX + BinY * BinsX];
+			const auto Found = std::find(CurBin.begin(), CurBin.end(), ID);
+			*Found = CurBin.back();
+			CurBin.pop_back();
+		}
+	}
+}
+
+void Scene::MarkDirty(const Rect& Area)
+{
+	if( !Area.Empty() )
+	{
+		Dirty.push_back(Area);
+	}
+}
+}
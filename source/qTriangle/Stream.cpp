@@ -0,0 +1,171 @@
+#include <qTriangle/Stream.hpp>
+
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace qTri
+{
+// Points per chunk, 128KiB of input and 16KiB of output stay within L2
+constexpr std::size_t ChunkPoints = 1 << 14;
+// Number of chunks paged in ahead of the kernel
+constexpr std::size_t ReadaheadChunks = 64;
+
+#if defined(__unix__) || defined(__APPLE__)
+
+bool ClassifyFile(
+	const char* InputPath, const char* OutputPath,
+	const Triangle Tris[], std::size_t TriCount,
+	FillFunction Fill,
+	StreamStats* Stats
+)
+{
+	const int InputFile = open(InputPath, O_RDONLY);
+	if( InputFile < 0 )
+	{
+		return false;
+	}
+	struct stat InputStat;
+	if( fstat(InputFile, &InputStat) != 0 )
+	{
+		close(InputFile);
+		return false;
+	}
+	const std::size_t Count = InputStat.st_size / sizeof(glm::i32vec2);
+
+	// Fresh zero-filled output, the kernels accumulate into their results
+	const int OutputFile = open(OutputPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if( OutputFile < 0 || ftruncate(OutputFile, Count) != 0 )
+	{
+		close(InputFile);
+		if( OutputFile >= 0 )
+		{
+			close(OutputFile);
+		}
+		return false;
+	}
+
+	if( Count == 0 )
+	{
+		close(InputFile);
+		close(OutputFile);
+		if( Stats )
+		{
+			*Stats = StreamStats{0, std::chrono::nanoseconds::zero()};
+		}
+		return true;
+	}
+
+	const std::size_t InputSize = Count * sizeof(glm::i32vec2);
+	void* const InputMap = mmap(
+		nullptr, InputSize, PROT_READ, MAP_PRIVATE, InputFile, 0
+	);
+	void* const OutputMap = mmap(
+		nullptr, Count, PROT_READ | PROT_WRITE, MAP_SHARED, OutputFile, 0
+	);
+	// The mappings keep the files referenced
+	close(InputFile);
+	close(OutputFile);
+	if( InputMap == MAP_FAILED || OutputMap == MAP_FAILED )
+	{
+		if( InputMap != MAP_FAILED )
+		{
+			munmap(InputMap, InputSize);
+		}
+		if( OutputMap != MAP_FAILED )
+		{
+			munmap(OutputMap, Count);
+		}
+		return false;
+	}
+	madvise(InputMap, InputSize, MADV_SEQUENTIAL);
+	madvise(OutputMap, Count, MADV_SEQUENTIAL);
+
+	const glm::i32vec2* Points = static_cast<const glm::i32vec2*>(InputMap);
+	std::uint8_t* Results = static_cast<std::uint8_t*>(OutputMap);
+	const std::uintptr_t PageMask = ~std::uintptr_t(sysconf(_SC_PAGESIZE) - 1);
+
+	const auto Start = std::chrono::steady_clock::now();
+	for( std::size_t i = 0; i < Count; i += ChunkPoints )
+	{
+		const std::size_t CurCount = std::min(ChunkPoints, Count - i);
+
+		// Page in the window ahead of the kernel while this chunk computes
+		// Windows are issued a full window at a time to keep syscalls rare
+		if( (i / ChunkPoints) % ReadaheadChunks == 0 )
+		{
+			const std::size_t AheadBegin = i + ReadaheadChunks * ChunkPoints;
+			if( AheadBegin < Count )
+			{
+				const std::uintptr_t AheadAddr = reinterpret_cast<std::uintptr_t>(
+					Points + AheadBegin
+				) & PageMask;
+				const std::size_t AheadEnd = std::min(
+					Count, AheadBegin + ReadaheadChunks * ChunkPoints
+				);
+				madvise(
+					reinterpret_cast<void*>(AheadAddr),
+					reinterpret_cast<std::uintptr_t>(Points + AheadEnd) - AheadAddr,
+					MADV_WILLNEED
+				);
+			}
+		}
+
+		// All triangles are applied while the chunk is still in cache
+		for( std::size_t t = 0; t < TriCount; ++t )
+		{
+			Fill(Points + i, Results + i, CurCount, Tris[t]);
+		}
+
+		// Release the input pages behind the kernel so the stream does
+		// not evict the rest of the page cache's working set
+		if( (i / ChunkPoints) % ReadaheadChunks == ReadaheadChunks - 1 )
+		{
+			const std::uintptr_t BehindBegin = reinterpret_cast<std::uintptr_t>(
+				Points + (i + CurCount) - ReadaheadChunks * ChunkPoints
+			) & PageMask;
+			const std::uintptr_t BehindEnd = reinterpret_cast<std::uintptr_t>(
+				Points + i + CurCount
+			) & PageMask;
+			madvise(
+				reinterpret_cast<void*>(BehindBegin),
+				BehindEnd - BehindBegin,
+				MADV_DONTNEED
+			);
+		}
+	}
+	const auto Duration = std::chrono::steady_clock::now() - Start;
+
+	munmap(InputMap, InputSize);
+	munmap(OutputMap, Count);
+
+	if( Stats )
+	{
+		*Stats = StreamStats{
+			Count,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(Duration)
+		};
+	}
+	return true;
+}
+
+#else
+
+bool ClassifyFile(
+	const char*, const char*,
+	const Triangle[], std::size_t,
+	FillFunction,
+	StreamStats*
+)
+{
+	// Memory mapped streaming is only implemented for POSIX systems
+	return false;
+}
+
+#endif
+}
@@ -5,20 +5,33 @@ namespace qTri
 {
 namespace Util
 {
-void Draw(const qTri::Image& Frame)
+static void Draw(
+	const std::uint8_t* Pixels,
+	std::size_t Width, std::size_t Height, std::size_t Stride
+)
 {
-	for( std::size_t y = 0; y < Frame.Height; ++y )
+	for( std::size_t y = 0; y < Height; ++y )
 	{
 		std::fputs("\033[0;35m|\033[1;36m", stdout);
-		for( std::size_t x = 0; x < Frame.Width; ++x )
+		for( std::size_t x = 0; x < Width; ++x )
 		{
 			std::putchar(
-				" @"[Frame.Pixels[x + y * Frame.Width] & 1]
+				" @"[Pixels[x + y * Stride] & 1]
 			);
 		}
 		std::fputs("\033[0;35m|\n", stdout);
 	}
 	std::fputs("\033[0m", stdout);
 }
+
+void Draw(const qTri::Image& Frame)
+{
+	Draw(Frame.Pixels.data(), Frame.Width, Frame.Height, Frame.Stride);
+}
+
+void Draw(const qTri::ImageView& View)
+{
+	Draw(View.Pixels, View.Width, View.Height, View.Stride);
+}
 }
 }
@@ -1,129 +1,77 @@
 #include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
 
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/glm.hpp>
-#include <glm/gtx/component_wise.hpp>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 
 namespace qTri
 {
 
-// Get Cross-Product Z component from two directional vectors
-inline std::int32_t Det(
-	const glm::i32vec2& Top,
-	const glm::i32vec2& Bottom
-)
-{
-	return Top.x * Bottom.y - Top.y * Bottom.x;
-}
-
-//// Cross Product Method
+//// Exports
 
-template<std::uint8_t WidthExp2>
-inline void CrossProductMethod(
-	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-	const Triangle& Tri
-)
-{
-	CrossProductMethod<WidthExp2-1>(
-		Points, Results, Count,
-		Tri
-	);
-}
+// Largest coordinates before the integer products of each method overflow
+// Cross-Product: Edge and point directions span 2L, Det = 2 * (2L)^2 products
+constexpr std::int32_t CrossProductLimit = 16383;
+// Barycentric: U + V sums six determinants of absolute coordinates, 12L^2
+constexpr std::int32_t BarycentricLimit = 13377;
 
-//// Barycentric Method
+const std::vector<FillKernel> FillAlgorithms = {
+	// Cross-Product methods
+	{
+		CrossProductMethod<0>, "Serial-CrossProduct", SerialISA,
+		1, CrossProductLimit, true
+	},
+	{
+		CrossProductMethod<CrossProductWidthExp2>, "CrossProductMethod",
+		CrossProductISA,
+		1u << CrossProductWidthExp2, CrossProductLimit, true
+	},
+	// Barycentric methods
+	{
+		BarycentricMethod<0>, "Serial-Barycentric", SerialISA,
+		1, BarycentricLimit, false
+	},
+	{
+		BarycentricMethod<BarycentricWidthExp2>, "BarycentricMethod",
+		BarycentricISA,
+		1u << BarycentricWidthExp2, BarycentricLimit, false
+	},
+};
 
-template<std::uint8_t WidthExp2>
-inline void BarycentricMethod(
-	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-	const Triangle& Tri
-)
+void FillView(const ImageView& View, const Triangle& Tri, FillFunction Fill)
 {
-	BarycentricMethod<WidthExp2-1>(
-		Points, Results, Count,
-		Tri
+	ForEachViewRow(
+		View, Tri,
+		[&](
+			std::size_t y, std::size_t x,
+			const glm::i32vec2 RowPoints[], std::size_t Count
+		)
+		{
+			Fill(RowPoints, View.Row(y) + x, Count, Tri);
+		}
 	);
 }
 
-#if defined(__x86_64__) || defined(_M_X64)
-#include "qTriangle-x86.hpp"
-#else
-template<>
-inline void CrossProductMethod<0>(
-	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-	const Triangle& Tri
-)
-{
-	// Directional vectors along all three triangle edges
-	const glm::i32vec2 EdgeDir[3] = {
-		Tri[1] - Tri[0],
-		Tri[2] - Tri[1],
-		Tri[0] - Tri[2]
-	};
-
-	for( std::size_t i = 0; i < Count; ++i )
-	{
-		const glm::i32vec2 PointDir[3] = {
-			Points[i] - Tri[0],
-			Points[i] - Tri[1],
-			Points[i] - Tri[2]
-		};
-
-		const glm::i32vec3 Crosses = glm::vec3(
-			Det( EdgeDir[0], PointDir[0] ),
-			Det( EdgeDir[1], PointDir[1] ),
-			Det( EdgeDir[2], PointDir[2] )
-		);
-
-		Results[i] |= glm::all(
-			glm::greaterThanEqual(
-				Crosses,
-				glm::i32vec3(0)
-			)
-		);
-	}
-}
+// Assumed when the host does not report its caches
+constexpr std::size_t DefaultCacheSize = 8 << 20;
 
-template<>
-inline void BarycentricMethod<0>(
-	const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-	const Triangle& Tri
-)
+std::size_t LastLevelCacheSize()
 {
-	const std::int32_t Det01 = Det( Tri[0], Tri[1] );
-	const std::int32_t Det20 = Det( Tri[2], Tri[0] );
-	const std::int32_t Area  = Det( Tri[1], Tri[2] ) + Det20 + Det01;
-
-	for( std::size_t i = 0; i < Count; ++i )
+	static const std::size_t CacheSize = []() -> std::size_t
 	{
-		const std::int32_t U = Det20
-			+ Det(    Tri[0], Points[i] )
-			+ Det( Points[i],    Tri[2] );
-		const std::int32_t V = Det01
-			+ Det(    Tri[1], Points[i] )
-			+ Det( Points[i],    Tri[0] );
-
-		Results[i] |= (U + V) < Area && U >= 0 && V >= 0;
-	}
-}
+#if defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+		for( const int Level : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE} )
+		{
+			const long Size = sysconf(Level);
+			if( Size > 0 )
+			{
+				return static_cast<std::size_t>(Size);
+			}
+		}
 #endif
-
-//// Exports
-
-const std::vector<
-	std::pair<
-		void(* const)(
-			const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t Count,
-			const Triangle& Tri
-		),
-		const char*
-	>
-> FillAlgorithms = {
-	// Cross-Product methods
-	{CrossProductMethod<  0>,	"Serial-CrossProduct"},
-	{CrossProductMethod< -1>,	"CrossProductMethod"},
-	// Barycentric methods
-	{BarycentricMethod<  0>,	"Serial-Barycentric"},
-	{BarycentricMethod< -1>,	"BarycentricMethod"},
-};
+		return DefaultCacheSize;
+	}();
+	return CacheSize;
+}
 }
-
@@ -0,0 +1,170 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Autotune.hpp>
+
+// Decisions of the autotuner, removed before and after the test
+constexpr const char* CachePath = "Autotune.cache";
+
+// A small workload that every registered kernel may take
+constexpr qTri::Workload Shape = {64, 64, 16, 64, false};
+
+static std::vector<std::string> CacheLines()
+{
+	std::vector<std::string> Lines;
+	std::ifstream Cache(CachePath);
+	for( std::string Line; std::getline(Cache, Line); )
+	{
+		Lines.push_back(Line);
+	}
+	return Lines;
+}
+
+static void WriteCache(const std::vector<std::string>& Lines)
+{
+	std::ofstream Cache(CachePath, std::ios::trunc);
+	for( const std::string& Line : Lines )
+	{
+		Cache << Line << '\n';
+	}
+}
+
+static bool Registered(const qTri::FillKernel* Kernel)
+{
+	return std::any_of(
+		qTri::FillAlgorithms.begin(), qTri::FillAlgorithms.end(),
+		[Kernel](const qTri::FillKernel& CurKernel) -> bool
+		{
+			return &CurKernel == Kernel;
+		}
+	);
+}
+
+// Kernels are left out when the processor lacks their instruction set, their
+// coordinates do not reach far enough, or their edges are half-open where
+// inclusive edges are asked for
+static std::size_t CheckEligible()
+{
+	const std::vector<qTri::FillKernel> Kernels = {
+		{nullptr, "Serial-Wide", "Serial", 1, 1000, true},
+		{nullptr, "Serial-Narrow", "Serial", 1, 100, true},
+		{nullptr, "Serial-HalfOpen", "Serial", 1, 1000, false},
+		{nullptr, "SSE4.1-Wide", "SSE4.1", 4, 1000, true},
+		{nullptr, "Unknown-Wide", "Unknown", 8, 1000, true},
+	};
+	const auto Names = [&Kernels](const qTri::Workload& CurShape)
+	{
+		std::vector<std::string> Eligible;
+		for( const qTri::FillKernel* CurKernel : qTri::EligibleKernels(CurShape, Kernels) )
+		{
+			Eligible.push_back(CurKernel->Name);
+		}
+		return Eligible;
+	};
+	const bool SSE = qTri::ISASupported("SSE4.1");
+	std::size_t Mismatches = 0;
+
+	std::vector<std::string> Expected = {"Serial-Wide", "Serial-Narrow", "Serial-HalfOpen"};
+	if( SSE )
+	{
+		Expected.push_back("SSE4.1-Wide");
+	}
+	Mismatches += Names({64, 64, 16, 100, false}) != Expected;
+
+	Expected = {"Serial-Wide", "Serial-HalfOpen"};
+	if( SSE )
+	{
+		Expected.push_back("SSE4.1-Wide");
+	}
+	Mismatches += Names({64, 64, 16, 101, false}) != Expected;
+
+	Expected = {"Serial-Wide"};
+	if( SSE )
+	{
+		Expected.push_back("SSE4.1-Wide");
+	}
+	Mismatches += Names({64, 64, 16, 101, true}) != Expected;
+
+	Mismatches += !Names({64, 64, 16, 1001, false}).empty();
+	Mismatches += qTri::ISASupported("Unknown");
+
+	// Every registered kernel was built for this processor
+	Mismatches += qTri::EligibleKernels({64, 64, 16, 0, false}).size()
+		!= qTri::FillAlgorithms.size();
+	// Nothing reaches past every limit
+	Mismatches += qTri::Autotune({64, 64, 16, INT32_MAX, false}) != nullptr;
+	return Mismatches;
+}
+
+// Decisions are measured and appended once, then read back from the cache
+// Lines that are corrupt, or that name a kernel that no longer exists, are
+// skipped and the kernels measured again
+static std::size_t CheckCache()
+{
+	std::size_t Mismatches = 0;
+	std::remove(CachePath);
+
+	// Measured, and appended as "Key Name"
+	const qTri::FillKernel* Fastest = qTri::Autotune(Shape, CachePath);
+	Mismatches += !Registered(Fastest);
+	std::vector<std::string> Lines = CacheLines();
+	if( Fastest == nullptr || Lines.size() != 1 )
+	{
+		return Mismatches + 1;
+	}
+	const std::size_t Split = Lines[0].rfind(' ');
+	const std::string Key = Lines[0].substr(0, Split);
+	Mismatches += Lines[0].substr(Split + 1) != Fastest->Name;
+
+	// Read back without measuring or appending
+	Mismatches += qTri::Autotune(Shape, CachePath) != Fastest;
+	Mismatches += CacheLines().size() != 1;
+
+	// A cached decision is taken as it is, even if it is not the fastest
+	const qTri::FillKernel& Other = &qTri::FillAlgorithms.front() == Fastest
+		? qTri::FillAlgorithms.back() : qTri::FillAlgorithms.front();
+	WriteCache({Key + ' ' + Other.Name});
+	Mismatches += qTri::Autotune(Shape, CachePath) != &Other;
+	Mismatches += CacheLines().size() != 1;
+
+	// Corrupt and stale lines fall back to measuring, which appends
+	const std::vector<std::string> Stale = {
+		"",
+		"NoSeparator",
+		Key,
+		Key + ' ',
+		Key + " NoSuchKernel",
+		Key.substr(0, Key.size() / 2) + ' ' + Fastest->Name,
+		Key + "/Extra " + Fastest->Name,
+	};
+	for( const std::string& CurLine : Stale )
+	{
+		WriteCache({CurLine});
+		Mismatches += !Registered(qTri::Autotune(Shape, CachePath));
+		Lines = CacheLines();
+		Mismatches += Lines.size() != 2 || Lines[1].compare(0, Split + 1, Key + ' ') != 0;
+	}
+
+	std::remove(CachePath);
+	return Mismatches;
+}
+
+// Checks kernel eligibility and the autotuner's cache file
+int main()
+{
+	const std::size_t EligibleFailures = CheckEligible();
+	std::printf("Eligible\t| %zu mismatches\n", EligibleFailures);
+	const std::size_t CacheFailures = CheckCache();
+	std::printf("Cache\t| %zu mismatches\n", CacheFailures);
+	const std::size_t Failures = EligibleFailures + CacheFailures;
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,5 +1,22 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
 #include <chrono>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#endif
 
 // Measures the time it takes to execute a execute a function
 
@@ -19,3 +36,126 @@ struct Bench
 		);
 	}
 };
+
+// Low-overhead tick counter
+// Uses the time stamp counter on x86 and the steady clock elsewhere
+struct TickClock
+{
+	static std::uint64_t Now()
+	{
+#if defined(__x86_64__) || defined(_M_X64)
+		// rdtscp waits for prior instructions, lfence keeps later ones from
+		// starting early
+		unsigned int Aux;
+		const std::uint64_t Ticks = __rdtscp(&Aux);
+		_mm_lfence();
+		return Ticks;
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+#endif
+	}
+
+	// Ticks per nanosecond, calibrated once against the steady clock
+	// On x86 these are reference cycles of the time stamp counter
+	static double TicksPerNanosecond()
+	{
+		static const double Rate = []() -> double
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			const std::uint64_t StartTicks = Now();
+			while(
+				std::chrono::steady_clock::now() - Start
+					< std::chrono::milliseconds(50)
+			);
+			const std::uint64_t Ticks = Now() - StartTicks;
+			return Ticks / static_cast<double>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - Start
+				).count()
+			);
+		}();
+		return Rate;
+	}
+};
+
+// Statistics of a set of samples
+// Benchmark's Measure takes Min, Mean and Median over batches and P99 and
+// StdDev over single triangles
+struct BenchStats
+{
+	std::size_t Count;
+	double Min;
+	double Mean;
+	double Median;
+	double P99;
+	double StdDev;
+
+	static BenchStats From(std::vector<double> Samples)
+	{
+		BenchStats Stats{};
+		if( Samples.empty() )
+		{
+			return Stats;
+		}
+		std::sort(Samples.begin(), Samples.end());
+		Stats.Count = Samples.size();
+		Stats.Min = Samples.front();
+		Stats.Mean = std::accumulate(
+			Samples.begin(), Samples.end(), 0.0
+		) / Samples.size();
+		Stats.Median = Samples[Samples.size() / 2];
+		Stats.P99 = Samples[
+			std::min(Samples.size() - 1, (Samples.size() * 99) / 100)
+		];
+		double Variance = 0.0;
+		for( const double CurSample : Samples )
+		{
+			Variance += (CurSample - Stats.Mean) * (CurSample - Stats.Mean);
+		}
+		Stats.StdDev = std::sqrt(Variance / Samples.size());
+		return Stats;
+	}
+};
+
+// Pins the calling thread to a single core so samples do not migrate between
+// caches or frequency domains
+inline bool PinThread(std::size_t Core = 0)
+{
+#if defined(__linux__)
+	cpu_set_t CPUSet;
+	CPU_ZERO(&CPUSet);
+	CPU_SET(Core, &CPUSet);
+	return sched_setaffinity(0, sizeof(cpu_set_t), &CPUSet) == 0;
+#elif defined(_WIN32)
+	return SetThreadAffinityMask(
+		GetCurrentThread(), DWORD_PTR(1) << Core
+	) != 0;
+#else
+	return false;
+#endif
+}
+
+// Times a batch of work at a time rather than each call so that reading the
+// clock does not pollute short kernels
+// Warmup batches are run first and discarded
+// Returns the ticks of each batch
+template< typename FunctionT >
+std::vector<double> SampleBatches(
+	FunctionT&& Batch, std::size_t BatchCount, std::size_t Warmup
+)
+{
+	for( std::size_t i = 0; i < Warmup; ++i )
+	{
+		Batch(i % BatchCount);
+	}
+	std::vector<double> Samples(BatchCount);
+	for( std::size_t i = 0; i < BatchCount; ++i )
+	{
+		const std::uint64_t Start = TickClock::Now();
+		Batch(i);
+		Samples[i] = static_cast<double>(TickClock::Now() - Start);
+	}
+	return Samples;
+}
@@ -0,0 +1,259 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/utsname.h>
+#endif
+
+#include "Bench.hpp"
+
+// Machine-readable benchmark results
+// Files start with '#' comment lines describing the host, followed by a CSV
+// header and one row per algorithm
+struct BenchRecord
+{
+	std::string Algorithm;
+	std::string ISA;
+	std::size_t Width;
+	std::size_t Height;
+	std::size_t Triangles;
+	std::uint32_t Seed;
+	BenchStats Stats;
+};
+
+inline std::string HostDescription()
+{
+	std::string Host;
+#if defined(__unix__) || defined(__APPLE__)
+	utsname Name;
+	if( uname(&Name) == 0 )
+	{
+		Host += std::string(Name.nodename) + " " + Name.sysname + " "
+			+ Name.release + " " + Name.machine;
+	}
+#endif
+	std::ifstream CPUInfo("/proc/cpuinfo");
+	for( std::string Line; std::getline(CPUInfo, Line); )
+	{
+		if( Line.compare(0, 10, "model name") == 0 )
+		{
+			Host += " |" + Line.substr(Line.find(':') + 1);
+			break;
+		}
+	}
+#if defined(__VERSION__)
+	Host += std::string(" | ") + __VERSION__;
+#endif
+	return Host;
+}
+
+inline bool WriteRecords(const char* Path, const std::vector<BenchRecord>& Records)
+{
+	std::FILE* File = std::fopen(Path, "w");
+	if( File == nullptr )
+	{
+		return false;
+	}
+	std::fprintf(File, "# Host: %s\n", HostDescription().c_str());
+	std::fprintf(
+		File,
+		"Algorithm,ISA,Width,Height,Triangles,Seed,"
+		"Samples,MinNs,MeanNs,MedianNs,P99Ns,StdDevNs\n"
+	);
+	for( const BenchRecord& CurRecord : Records )
+	{
+		std::fprintf(
+			File,
+			"%s,%s,%zu,%zu,%zu,%u,%zu,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+			CurRecord.Algorithm.c_str(),
+			CurRecord.ISA.c_str(),
+			CurRecord.Width,
+			CurRecord.Height,
+			CurRecord.Triangles,
+			CurRecord.Seed,
+			CurRecord.Stats.Count,
+			CurRecord.Stats.Min,
+			CurRecord.Stats.Mean,
+			CurRecord.Stats.Median,
+			CurRecord.Stats.P99,
+			CurRecord.Stats.StdDev
+		);
+	}
+	std::fclose(File);
+	return true;
+}
+
+// Fields must hold a number and nothing else, truncated or hand-edited rows
+// are rejected rather than read as zero
+inline bool ParseField(const std::string& Field, std::size_t& Value)
+{
+	if( Field.empty() || Field[0] == '-' )
+	{
+		return false;
+	}
+	char* End = nullptr;
+	errno = 0;
+	const unsigned long long Parsed = std::strtoull(Field.c_str(), &End, 10);
+	if( errno != 0 || End != Field.c_str() + Field.size() )
+	{
+		return false;
+	}
+	Value = static_cast<std::size_t>(Parsed);
+	return true;
+}
+
+inline bool ParseField(const std::string& Field, double& Value)
+{
+	if( Field.empty() )
+	{
+		return false;
+	}
+	char* End = nullptr;
+	errno = 0;
+	Value = std::strtod(Field.c_str(), &End);
+	return errno == 0 && End == Field.c_str() + Field.size();
+}
+
+// Returns false if the file is missing or any row fails to parse
+inline bool ReadRecords(const char* Path, std::vector<BenchRecord>& Records)
+{
+	std::ifstream File(Path);
+	if( !File )
+	{
+		return false;
+	}
+	bool Header = true;
+	for( std::string Line; std::getline(File, Line); )
+	{
+		if( Line.empty() || Line[0] == '#' )
+		{
+			continue;
+		}
+		if( Header )
+		{
+			Header = false;
+			continue;
+		}
+		std::vector<std::string> Fields;
+		std::istringstream Row(Line);
+		for( std::string Field; std::getline(Row, Field, ','); )
+		{
+			Fields.push_back(Field);
+		}
+		if( Fields.size() != 12 )
+		{
+			return false;
+		}
+		BenchRecord CurRecord;
+		CurRecord.Algorithm = Fields[0];
+		CurRecord.ISA = Fields[1];
+		std::size_t Seed;
+		if(
+			!ParseField(Fields[2], CurRecord.Width)
+			|| !ParseField(Fields[3], CurRecord.Height)
+			|| !ParseField(Fields[4], CurRecord.Triangles)
+			|| !ParseField(Fields[5], Seed) || Seed > UINT32_MAX
+			|| !ParseField(Fields[6], CurRecord.Stats.Count)
+			|| !ParseField(Fields[7], CurRecord.Stats.Min)
+			|| !ParseField(Fields[8], CurRecord.Stats.Mean)
+			|| !ParseField(Fields[9], CurRecord.Stats.Median)
+			|| !ParseField(Fields[10], CurRecord.Stats.P99)
+			|| !ParseField(Fields[11], CurRecord.Stats.StdDev)
+		)
+		{
+			return false;
+		}
+		CurRecord.Seed = static_cast<std::uint32_t>(Seed);
+		Records.push_back(CurRecord);
+	}
+	return true;
+}
+
+// Record of the same algorithm in Records, if any
+inline const BenchRecord* FindRecord(
+	const std::vector<BenchRecord>& Records, const std::string& Algorithm
+)
+{
+	for( const BenchRecord& CurRecord : Records )
+	{
+		if( CurRecord.Algorithm == Algorithm )
+		{
+			return &CurRecord;
+		}
+	}
+	return nullptr;
+}
+
+// Whether two records were measured the same way and may be compared
+inline bool SameParameters(const BenchRecord& A, const BenchRecord& B)
+{
+	return A.ISA == B.ISA
+		&& A.Width == B.Width
+		&& A.Height == B.Height
+		&& A.Triangles == B.Triangles
+		&& A.Seed == B.Seed;
+}
+
+// Noise only ever adds time, so the fastest batch of each algorithm is what
+// is compared
+inline double MinChange(const BenchRecord& Base, const BenchRecord& Current)
+{
+	return (Current.Stats.Min - Base.Stats.Min) / Base.Stats.Min * 100.0;
+}
+
+// Compares matching algorithms of two result sets
+// A regression is a slowdown of the fastest batch above ThresholdPercent
+// Rows measured with other parameters than the baseline are refused
+// Returns the number of regressions and refused rows
+inline std::size_t CompareRecords(
+	const std::vector<BenchRecord>& Baseline,
+	const std::vector<BenchRecord>& Current,
+	double ThresholdPercent
+)
+{
+	std::size_t Failures = 0;
+	std::printf(
+		"Algorithm | Baseline min(ns) | Current min(ns) | Change"
+		" | Baseline median(ns) | Current median(ns)\n"
+	);
+	for( const BenchRecord& CurRecord : Current )
+	{
+		const BenchRecord* BaseRecord = FindRecord(Baseline, CurRecord.Algorithm);
+		if( BaseRecord == nullptr )
+		{
+			std::printf("%s\t| new\n", CurRecord.Algorithm.c_str());
+			continue;
+		}
+		if( !SameParameters(*BaseRecord, CurRecord) )
+		{
+			std::printf(
+				"%s\t| parameters differ from the baseline, refused\n",
+				CurRecord.Algorithm.c_str()
+			);
+			++Failures;
+			continue;
+		}
+		const double Change = MinChange(*BaseRecord, CurRecord);
+		const bool Regressed = Change > ThresholdPercent;
+		Failures += Regressed;
+		std::printf(
+			"%s\t| %.1f\t| %.1f\t| %+.2f%%\t| %.1f\t| %.1f%s\n",
+			CurRecord.Algorithm.c_str(),
+			BaseRecord->Stats.Min,
+			CurRecord.Stats.Min,
+			Change,
+			BaseRecord->Stats.Median,
+			CurRecord.Stats.Median,
+			Regressed ? "\t| REGRESSION" : ""
+		);
+	}
+	return Failures;
+}
@@ -1,15 +1,29 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cmath>
 #include <type_traits>
 #include <algorithm>
 #include <random>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 
 #include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Autotune.hpp>
+#include <qTriangle/Kernels.hpp>
 
 #include "Bench.hpp"
+#include "BenchHistory.hpp"
+#include "PerfCounters.hpp"
+#include "Triangles.hpp"
 
 #ifdef _WIN32
 #define NOMINMAX
@@ -39,88 +53,1202 @@ static const bool _WndV100Enabled = []() -> bool
 constexpr std::size_t Width = 80;
 constexpr std::size_t Height = 50;
 constexpr std::size_t Loops = 5;
-static qTri::Triangle Triangles[100'000];
+// Triangles timed per sample
+constexpr std::size_t BatchSize = 1'000;
+constexpr std::size_t TriangleCount = 100'000;
+// Seed used when none is given, keeps runs reproducible
+constexpr std::uint32_t DefaultSeed = 0x7154'0B3D;
 
-int main()
+// Equilateral triangle with a random rotation covering Ratio of the grid's area
+template< std::size_t RatioPercent >
+static qTri::Triangle CoverageTriangle(
+	std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight
+)
 {
-	// Generate random triangles
-	std::random_device RandomDevice;
-	std::mt19937 RandomEngine(RandomDevice());
-	std::uniform_int_distribution<std::int32_t> WidthDis(0, Width);
-	std::uniform_int_distribution<std::int32_t> HeightDis(0, Height);
-	for( qTri::Triangle& CurTriangle : Triangles )
+	const glm::float32_t Area = GridWidth * GridHeight * (RatioPercent / 100.0f);
+	// Circumradius from area, A = (3 * sqrt(3) / 4) * R^2
+	const glm::float32_t Radius = std::sqrt(Area / (0.75f * std::sqrt(3.0f)));
+	std::uniform_real_distribution<glm::float32_t> AngleDis(0, glm::two_pi<glm::float32_t>());
+	std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth);
+	std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight);
+	const glm::i32vec2 Center(WidthDis(RandomEngine), HeightDis(RandomEngine));
+	const glm::float32_t Angle = AngleDis(RandomEngine);
+	qTri::Triangle CurTriangle;
+	for( std::size_t i = 0; i < 3; ++i )
 	{
-		glm::i32vec2 Center{};
-		// Randomly place vertices
-		for( glm::i32vec2& CurVert : CurTriangle )
-		{
-			CurVert.x = WidthDis(RandomEngine);
-			CurVert.y = HeightDis(RandomEngine);
-			Center += CurVert;
-		}
-		// Sort points in clockwise order
-		Center /= 3;
-		std::sort(
-			std::begin(CurTriangle),
-			std::end(CurTriangle),
-			[&Center](const glm::i32vec2& A, const glm::i32vec2& B) -> bool
+		const glm::float32_t CurAngle = Angle + i * glm::two_pi<glm::float32_t>() / 3;
+		CurTriangle[i] = Center + glm::i32vec2(
+			Radius * glm::cos(CurAngle), Radius * glm::sin(CurAngle)
+		);
+	}
+	return CurTriangle;
+}
+
+// Triangle size distributions
+static const std::pair<
+	qTri::Triangle(* const)(
+		std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight
+	),
+	const char*
+> TriangleShapes[] = {
+	{
+		// Vertices anywhere on the grid
+		[](std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight)
+		{
+			std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth);
+			std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight);
+			qTri::Triangle CurTriangle;
+			for( glm::i32vec2& CurVert : CurTriangle )
+			{
+				CurVert.x = WidthDis(RandomEngine);
+				CurVert.y = HeightDis(RandomEngine);
+			}
+			return CurTriangle;
+		},
+		"Random"
+	},
+	{
+		// Vertices within 8 pixels of each other
+		[](std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight)
+		{
+			std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth);
+			std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight);
+			std::uniform_int_distribution<std::int32_t> OffsetDis(-4, 4);
+			const glm::i32vec2 Center(WidthDis(RandomEngine), HeightDis(RandomEngine));
+			qTri::Triangle CurTriangle;
+			for( glm::i32vec2& CurVert : CurTriangle )
+			{
+				CurVert = Center + glm::i32vec2(
+					OffsetDis(RandomEngine), OffsetDis(RandomEngine)
+				);
+			}
+			return CurTriangle;
+		},
+		"Tiny"
+	},
+	{
+		// Long edge across the grid with the third vertex two pixels off of it
+		[](std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight)
+		{
+			std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth);
+			std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight);
+			qTri::Triangle CurTriangle;
+			CurTriangle[0] = glm::i32vec2(WidthDis(RandomEngine), HeightDis(RandomEngine));
+			CurTriangle[1] = glm::i32vec2(WidthDis(RandomEngine), HeightDis(RandomEngine));
+			const glm::i32vec2 Edge = CurTriangle[1] - CurTriangle[0];
+			const glm::float32_t Length = std::max(
+				1.0f, std::sqrt(static_cast<glm::float32_t>(glm::dot(Edge, Edge)))
+			);
+			CurTriangle[2] = (CurTriangle[0] + CurTriangle[1]) / 2 + glm::i32vec2(
+				-2.0f * Edge.y / Length, 2.0f * Edge.x / Length
+			);
+			return CurTriangle;
+		},
+		"Sliver"
+	},
+	{
+		// Covers the entire grid
+		[](std::mt19937& RandomEngine, std::size_t GridWidth, std::size_t GridHeight)
+		{
+			std::uniform_int_distribution<std::int32_t> WidthDis(0, GridWidth / 4);
+			std::uniform_int_distribution<std::int32_t> HeightDis(0, GridHeight / 4);
+			const glm::i32vec2 Offset(-WidthDis(RandomEngine), -HeightDis(RandomEngine));
+			return qTri::Triangle{
 				{
-					// Sort points by its angle from the center
-					const glm::i32vec2 DirectionA = Center - A;
-					const glm::i32vec2 DirectionB = Center - B;
-					const auto AngleA = glm::atan<glm::float32_t>(DirectionA.y, DirectionA.x);
-					const auto AngleB = glm::atan<glm::float32_t>(DirectionB.y, DirectionB.x);
-					return AngleA < AngleB;
+					Offset,
+					Offset + glm::i32vec2(3 * GridWidth, 0),
+					Offset + glm::i32vec2(0, 3 * GridHeight)
 				}
+			};
+		},
+		"FullScreen"
+	},
+	{CoverageTriangle< 1>,	"Coverage1%"},
+	{CoverageTriangle<10>,	"Coverage10%"},
+	{CoverageTriangle<50>,	"Coverage50%"},
+};
+
+// Grid sizes of the sweep, from 64x64 to 8K
+static const std::pair<std::size_t, std::size_t> GridSizes[] = {
+	{  64,   64},
+	{ 256,  256},
+	{1920, 1080},
+	{3840, 2160},
+	{7680, 4320},
+};
+
+// Point tests per algorithm for each sweep configuration
+constexpr std::size_t SweepBudget = std::size_t(1) << 26;
+
+static qTri::PointBuffer GenerateGrid(std::size_t GridWidth, std::size_t GridHeight)
+{
+	// Generate 2d grid of points to test against
+	qTri::PointBuffer FragCoords;
+	FragCoords.reserve(GridWidth * GridHeight);
+	for( std::size_t y = 0; y < GridHeight; ++y )
+	{
+		for( std::size_t x = 0; x < GridWidth; ++x )
+		{
+			FragCoords.emplace_back(x,y);
+		}
+	}
+	return FragCoords;
+}
+
+// Times batches of triangles and returns nanoseconds per triangle
+// Averaging a batch hides its slowest triangles, so P99 and StdDev come from
+// one more pass that times every triangle on its own
+template< typename FillAlgorithmT >
+static BenchStats Measure(
+	const FillAlgorithmT& FillAlgorithm,
+	const qTri::PointBuffer& FragCoords, std::uint8_t Results[],
+	const std::vector<qTri::Triangle>& Triangles, std::size_t CurBatchSize,
+	std::size_t CurLoops
+)
+{
+	const std::size_t BatchCount = Triangles.size() / CurBatchSize;
+	// Every batch is a different slice of the triangles, a full pass over
+	// all of them warms up caches and clocks before sampling
+	std::vector<double> Samples = SampleBatches(
+		[&](std::size_t Batch)
+		{
+			const std::size_t First = (Batch % BatchCount) * CurBatchSize;
+			for( std::size_t i = First; i < First + CurBatchSize; ++i )
+			{
+				FillAlgorithm.Fill(
+					FragCoords.data(),
+					Results,
+					FragCoords.size(),
+					Triangles[i]
+				);
+			}
+		},
+		BatchCount * CurLoops,
+		BatchCount
+	);
+	std::vector<double> Singles = SampleBatches(
+		[&](std::size_t Index)
+		{
+			FillAlgorithm.Fill(
+				FragCoords.data(),
+				Results,
+				FragCoords.size(),
+				Triangles[Index]
+			);
+		},
+		BatchCount * CurBatchSize,
+		0
+	);
+	// Ticks per batch to nanoseconds per triangle
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	for( double& CurSample : Samples )
+	{
+		CurSample /= TicksPerNs * CurBatchSize;
+	}
+	for( double& CurSample : Singles )
+	{
+		CurSample /= TicksPerNs;
+	}
+	BenchStats Stats = BenchStats::From(Samples);
+	const BenchStats Tail = BenchStats::From(Singles);
+	Stats.P99 = Tail.P99;
+	Stats.StdDev = Tail.StdDev;
+	return Stats;
+}
+
+// Benchmark sweep [csv|json] [Seed]
+static int Sweep(bool JSON, std::uint32_t Seed)
+{
+	if( JSON )
+	{
+		std::printf("[\n");
+	}
+	else
+	{
+		std::printf(
+			"Width,Height,Shape,Triangles,Coverage,Algorithm,"
+			"MedianNs,P99Ns,StdDevNs,PointsPerSecond\n"
+		);
+	}
+	bool FirstRecord = true;
+	for( std::size_t SizeIdx = 0; SizeIdx < std::extent<decltype(GridSizes)>::value; ++SizeIdx )
+	{
+		const std::size_t GridWidth = GridSizes[SizeIdx].first;
+		const std::size_t GridHeight = GridSizes[SizeIdx].second;
+		const qTri::PointBuffer FragCoords = GenerateGrid(GridWidth, GridHeight);
+		qTri::Image CurFrame(GridWidth, GridHeight);
+		qTri::Image Coverage(GridWidth, GridHeight);
+
+		const std::size_t CurTriangleCount = std::clamp<std::size_t>(
+			SweepBudget / FragCoords.size(), 8, TriangleCount
 		);
+		const std::size_t CurBatchSize = std::max<std::size_t>(1, CurTriangleCount / 32);
+
+		for( std::size_t ShapeIdx = 0; ShapeIdx < std::extent<decltype(TriangleShapes)>::value; ++ShapeIdx )
+		{
+			// Each configuration gets its own deterministic stream
+			std::seed_seq ConfigSeed{Seed, std::uint32_t(SizeIdx), std::uint32_t(ShapeIdx)};
+			std::mt19937 RandomEngine(ConfigSeed);
+			std::vector<qTri::Triangle> Triangles(CurTriangleCount);
+			for( qTri::Triangle& CurTriangle : Triangles )
+			{
+				CurTriangle = TriangleShapes[ShapeIdx].first(
+					RandomEngine, GridWidth, GridHeight
+				);
+				SortClockwise(CurTriangle);
+			}
+
+			// Measured coverage of the first few triangles
+			std::size_t Covered = 0;
+			const std::size_t CoverageSamples = std::min<std::size_t>(16, Triangles.size());
+			for( std::size_t i = 0; i < CoverageSamples; ++i )
+			{
+				std::fill(Coverage.Pixels.begin(), Coverage.Pixels.end(), 0);
+				qTri::CrossProductMethod<0>(
+					FragCoords.data(), Coverage.Pixels.data(), FragCoords.size(),
+					Triangles[i]
+				);
+				Covered += std::count(Coverage.Pixels.begin(), Coverage.Pixels.end(), 1);
+			}
+			const double CoverageRatio
+				= Covered / static_cast<double>(CoverageSamples * FragCoords.size());
+
+			for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+			{
+				const BenchStats Stats = Measure(
+					FillAlgorithm, FragCoords, CurFrame.Pixels.data(),
+					Triangles, CurBatchSize, 1
+				);
+				const double PointsPerSecond = FragCoords.size() / (Stats.Median * 1e-9);
+				if( JSON )
+				{
+					std::printf(
+						"%s\t{\"Width\": %zu, \"Height\": %zu, \"Shape\": \"%s\", "
+						"\"Triangles\": %zu, \"Coverage\": %.4f, \"Algorithm\": \"%s\", "
+						"\"MedianNs\": %.1f, \"P99Ns\": %.1f, \"StdDevNs\": %.1f, "
+						"\"PointsPerSecond\": %.4e}",
+						FirstRecord ? "" : ",\n",
+						GridWidth, GridHeight, TriangleShapes[ShapeIdx].second,
+						CurTriangleCount, CoverageRatio, FillAlgorithm.Name,
+						Stats.Median, Stats.P99, Stats.StdDev, PointsPerSecond
+					);
+				}
+				else
+				{
+					std::printf(
+						"%zu,%zu,%s,%zu,%.4f,%s,%.1f,%.1f,%.1f,%.4e\n",
+						GridWidth, GridHeight, TriangleShapes[ShapeIdx].second,
+						CurTriangleCount, CoverageRatio, FillAlgorithm.Name,
+						Stats.Median, Stats.P99, Stats.StdDev, PointsPerSecond
+					);
+				}
+				FirstRecord = false;
+				std::fflush(stdout);
+			}
+		}
+	}
+	if( JSON )
+	{
+		std::printf("\n]\n");
+	}
+	return EXIT_SUCCESS;
+}
+
+// Scattered points classified by Compact
+constexpr std::size_t CompactExtent = 1024;
+constexpr std::size_t CompactPoints = CompactExtent * CompactExtent;
+constexpr std::size_t CompactBatches = 64;
+
+// Benchmark compact [Seed]
+// Compares writing the indices of covered points against filling a coverage
+// array and scanning it afterwards, across hit rates
+static int Compact(std::uint32_t Seed)
+{
+	std::mt19937 RandomEngine(Seed);
+	std::uniform_int_distribution<std::int32_t> CoordDis(0, CompactExtent - 1);
+	qTri::PointBuffer Points(CompactPoints);
+	for( glm::i32vec2& CurPoint : Points )
+	{
+		CurPoint = glm::i32vec2(CoordDis(RandomEngine), CoordDis(RandomEngine));
+	}
+	std::vector<std::uint8_t> Results(Points.size());
+	std::vector<std::uint32_t> Indices(Points.size());
+	std::vector<std::uint32_t> Expected(Points.size());
+
+	std::printf(
+		"%zu points, %s compaction\n"
+		"Hit rate | Method | Median(ns) | Points per ns\n",
+		Points.size(), qTri::CrossProductCompactISA
+	);
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	bool Matches = true;
+	for( const double HitRate : {0.01, 0.10, 0.50} )
+	{
+		// Right triangle in the corner whose area is the hit rate
+		const std::int32_t Leg = static_cast<std::int32_t>(
+			std::sqrt(2.0 * HitRate) * CompactExtent
+		);
+		const qTri::Triangle Tri = {{{0, 0}, {Leg, 0}, {0, Leg}}};
+
+		// Fill followed by a scan of the coverage array
+		std::size_t ExpectedCount = 0;
+		const BenchStats ScanStats = BenchStats::From(
+			SampleBatches(
+				[&](std::size_t)
+				{
+					std::fill(Results.begin(), Results.end(), 0);
+					qTri::CrossProductMethod<qTri::CrossProductWidthExp2>(
+						Points.data(), Results.data(), Points.size(), Tri
+					);
+					ExpectedCount = 0;
+					for( std::size_t i = 0; i < Results.size(); ++i )
+					{
+						Expected[ExpectedCount] = static_cast<std::uint32_t>(i);
+						ExpectedCount += Results[i];
+					}
+				},
+				CompactBatches, 4
+			)
+		);
+		const auto Report = [&](const char* Name, const BenchStats& Stats)
+		{
+			std::printf(
+				"%.1f%%\t| %s\t| %.0f ns\t| %.3f\n",
+				100.0 * ExpectedCount / Points.size(), Name,
+				Stats.Median / TicksPerNs,
+				Points.size() / (Stats.Median / TicksPerNs)
+			);
+		};
+		Report("Fill+Scan", ScanStats);
+
+		const auto MeasureCompact = [&](const char* Name, auto CompactFunction)
+		{
+			std::size_t Written = 0;
+			const BenchStats Stats = BenchStats::From(
+				SampleBatches(
+					[&](std::size_t)
+					{
+						Written = CompactFunction(
+							Points.data(), Indices.data(), Points.size(), Tri
+						);
+					},
+					CompactBatches, 4
+				)
+			);
+			Report(Name, Stats);
+			Matches &= Written == ExpectedCount && std::equal(
+				Indices.begin(), Indices.begin() + Written, Expected.begin()
+			);
+		};
+		MeasureCompact("Serial-Compact", qTri::CrossProductCompact<0>);
+		MeasureCompact(
+			"CompactMethod",
+			qTri::CrossProductCompact<qTri::CrossProductCompactWidthExp2>
+		);
+	}
+	if( !Matches )
+	{
+		std::printf("Compacted indices differ from the coverage scan\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Benchmark query [Seed]
+// Compares counting covered points and testing for any covered point against
+// filling a coverage array and counting it afterwards
+static int Query(std::uint32_t Seed)
+{
+	std::mt19937 RandomEngine(Seed);
+	std::uniform_int_distribution<std::int32_t> CoordDis(0, CompactExtent - 1);
+	qTri::PointBuffer Points(CompactPoints);
+	for( glm::i32vec2& CurPoint : Points )
+	{
+		CurPoint = glm::i32vec2(CoordDis(RandomEngine), CoordDis(RandomEngine));
+	}
+	std::vector<std::uint8_t> Results(Points.size());
+
+	std::printf(
+		"%zu points, %s queries\n"
+		"Hit rate | Method | Median(ns) | Points per ns\n",
+		Points.size(), qTri::CrossProductQueryISA
+	);
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	bool Matches = true;
+	// A triangle past the extent misses every point, the worst case of Any
+	const std::int32_t Extent = CompactExtent;
+	const qTri::Triangle Miss = {{{Extent, Extent}, {2 * Extent, Extent}, {Extent, 2 * Extent}}};
+	for( const double HitRate : {0.0, 0.01, 0.50} )
+	{
+		const std::int32_t Leg = static_cast<std::int32_t>(
+			std::sqrt(2.0 * HitRate) * CompactExtent
+		);
+		const qTri::Triangle Tri = HitRate > 0.0
+			? qTri::Triangle{{{0, 0}, {Leg, 0}, {0, Leg}}} : Miss;
+
+		std::size_t Expected = 0;
+		const BenchStats ScanStats = BenchStats::From(
+			SampleBatches(
+				[&](std::size_t)
+				{
+					std::fill(Results.begin(), Results.end(), 0);
+					qTri::CrossProductMethod<qTri::CrossProductWidthExp2>(
+						Points.data(), Results.data(), Points.size(), Tri
+					);
+					Expected = std::count(Results.begin(), Results.end(), 1);
+				},
+				CompactBatches, 4
+			)
+		);
+		const auto Report = [&](const char* Name, const BenchStats& Stats)
+		{
+			std::printf(
+				"%.1f%%\t| %s\t| %.0f ns\t| %.3f\n",
+				100.0 * Expected / Points.size(), Name,
+				Stats.Median / TicksPerNs,
+				Points.size() / (Stats.Median / TicksPerNs)
+			);
+		};
+		Report("Fill+Count", ScanStats);
+
+		const auto MeasureQuery = [&](const char* Name, auto QueryFunction, std::size_t Correct)
+		{
+			std::size_t Result = 0;
+			const BenchStats Stats = BenchStats::From(
+				SampleBatches(
+					[&](std::size_t)
+					{
+						Result = QueryFunction(Points.data(), Points.size(), Tri);
+					},
+					CompactBatches, 4
+				)
+			);
+			Report(Name, Stats);
+			Matches &= Result == Correct;
+		};
+		MeasureQuery("Serial-Count", qTri::CrossProductCount<0>, Expected);
+		MeasureQuery(
+			"CountMethod",
+			qTri::CrossProductCount<qTri::CrossProductQueryWidthExp2>, Expected
+		);
+		MeasureQuery("Serial-Any", qTri::CrossProductAny<0>, Expected != 0);
+		MeasureQuery(
+			"AnyMethod",
+			qTri::CrossProductAny<qTri::CrossProductQueryWidthExp2>, Expected != 0
+		);
+	}
+	if( !Matches )
+	{
+		std::printf("Query results differ from the coverage count\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Grid whose coverage outgrows typical last level caches
+constexpr std::size_t OverwriteExtent = 8192;
+constexpr std::size_t OverwriteBatches = 8;
+
+// Benchmark overwrite
+// Compares clearing and ORing into a large coverage buffer against storing
+// coverage directly, with and without non-temporal stores
+static int Overwrite()
+{
+	const qTri::PointBuffer FragCoords = GenerateGrid(
+		OverwriteExtent, OverwriteExtent
+	);
+	const std::int32_t Extent = OverwriteExtent;
+	const qTri::Triangle Tri = {{{0, 0}, {Extent, 0}, {0, Extent}}};
+	qTri::Image Expected(OverwriteExtent, OverwriteExtent);
+	qTri::Image CurFrame(OverwriteExtent, OverwriteExtent);
+
+	std::printf(
+		"%zu MiB coverage, %zu MiB last level cache, %s stores\n"
+		"Method | Median(ms) | Output GB/s\n",
+		CurFrame.Pixels.size() >> 20, qTri::LastLevelCacheSize() >> 20,
+		qTri::CrossProductWriteISA
+	);
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	const auto Report = [&](const char* Name, const BenchStats& Stats)
+	{
+		const double Ns = Stats.Median / TicksPerNs;
+		std::printf(
+			"%s\t| %.2f ms\t| %.2f\n",
+			Name, Ns * 1e-6, CurFrame.Pixels.size() / Ns
+		);
+	};
+
+	Report(
+		"Clear+Fill",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t)
+				{
+					std::fill(Expected.Pixels.begin(), Expected.Pixels.end(), 0);
+					qTri::CrossProductMethod<qTri::CrossProductWidthExp2>(
+						FragCoords.data(), Expected.Pixels.data(),
+						FragCoords.size(), Tri
+					);
+				},
+				OverwriteBatches, 1
+			)
+		)
+	);
+	bool Matches = true;
+	for( const bool NonTemporal : {false, true} )
+	{
+		Report(
+			NonTemporal ? "Write-NonTemporal" : "Write",
+			BenchStats::From(
+				SampleBatches(
+					[&](std::size_t)
+					{
+						qTri::CrossProductWrite<qTri::CrossProductWriteWidthExp2>(
+							FragCoords.data(), CurFrame.Pixels.data(),
+							FragCoords.size(), Tri, NonTemporal
+						);
+					},
+					OverwriteBatches, 1
+				)
+			)
+		);
+		Matches &= CurFrame.Pixels == Expected.Pixels;
+	}
+	if( !Matches )
+	{
+		std::printf("Written coverage differs from the filled coverage\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Colour target of the blending benchmark
+constexpr std::size_t BlendExtent = 1024;
+constexpr std::size_t BlendTriangles = 256;
+
+// Benchmark blend [Seed]
+// Compares compositing a colour fused into the coverage test against filling
+// a coverage mask and blending through it in a second pass
+static int Blend(std::uint32_t Seed)
+{
+	std::mt19937 RandomEngine(Seed);
+	std::vector<qTri::Triangle> Triangles(BlendTriangles);
+	for( qTri::Triangle& CurTriangle : Triangles )
+	{
+		CurTriangle = TriangleShapes[0].first(RandomEngine, BlendExtent, BlendExtent);
+		SortClockwise(CurTriangle);
+	}
+	// Premultiplied half-transparent orange
+	const qTri::RGBA8 Colour{0x80, 0x40, 0x00, 0x80};
+
+	qTri::BasicImage<qTri::RGBA8> Fused(BlendExtent, BlendExtent);
+	qTri::BasicImage<qTri::RGBA8> TwoPass(BlendExtent, BlendExtent);
+	qTri::Image Mask(BlendExtent, BlendExtent);
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	const auto Report = [&](const char* Name, const BenchStats& Stats)
+	{
+		std::printf(
+			"%s\t| %.1f us per triangle\n", Name, Stats.Median / TicksPerNs * 1e-3
+		);
+	};
+
+	std::printf(
+		"%zu x %zu RGBA8, %zu triangles\n", BlendExtent, BlendExtent, BlendTriangles
+	);
+	Report(
+		"Fill+Blend",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Batch)
+				{
+					const qTri::Triangle& CurTriangle = Triangles[Batch % BlendTriangles];
+					std::fill(Mask.Pixels.begin(), Mask.Pixels.end(), 0);
+					qTri::FillView(
+						qTri::ImageView(Mask), CurTriangle,
+						qTri::CrossProductMethod<qTri::CrossProductWidthExp2>
+					);
+					for( std::size_t i = 0; i < Mask.Pixels.size(); ++i )
+					{
+						if( Mask.Pixels[i] )
+						{
+							TwoPass.Pixels[i] = qTri::BlendOver(TwoPass.Pixels[i], Colour);
+						}
+					}
+				},
+				BlendTriangles, 0
+			)
+		)
+	);
+	Report(
+		"BlendView",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Batch)
+				{
+					qTri::BlendView(
+						qTri::BasicImageView<qTri::RGBA8>(Fused),
+						Triangles[Batch % BlendTriangles], Colour
+					);
+				},
+				BlendTriangles, 0
+			)
+		)
+	);
+	if(
+		std::memcmp(
+			Fused.Pixels.data(), TwoPass.Pixels.data(),
+			Fused.Pixels.size() * sizeof(qTri::RGBA8)
+		) != 0
+	)
+	{
+		std::printf("Fused blending differs from blending through a mask\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Benchmark visibility [Seed]
+// Compares writing triangle IDs straight from the coverage test against
+// filling each triangle's coverage and writing IDs through it, for the main
+// benchmark's batch of triangles over its grid
+static int Visibility(std::uint32_t Seed)
+{
+	std::mt19937 RandomEngine(Seed);
+	std::vector<qTri::Triangle> Triangles(TriangleCount);
+	for( qTri::Triangle& CurTriangle : Triangles )
+	{
+		CurTriangle = TriangleShapes[0].first(RandomEngine, Width, Height);
+		SortClockwise(CurTriangle);
+	}
+	const qTri::PointBuffer FragCoords = GenerateGrid(Width, Height);
+	qTri::BasicImage<std::uint32_t> Fused(Width, Height);
+	qTri::BasicImage<std::uint32_t> TwoPass(Width, Height);
+	std::fill(Fused.Pixels.begin(), Fused.Pixels.end(), qTri::NoTriangle);
+	std::fill(TwoPass.Pixels.begin(), TwoPass.Pixels.end(), qTri::NoTriangle);
+	qTri::Image Coverage(Width, Height);
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	const auto Report = [&](const char* Name, const BenchStats& Stats)
+	{
+		std::printf(
+			"%s\t| %.1f ns per triangle\n", Name, Stats.Median / TicksPerNs / BatchSize
+		);
+	};
+
+	std::printf(
+		"%zu x %zu IDs, %zu triangles\n", Width, Height, TriangleCount
+	);
+	Report(
+		"Fill+IDs",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Batch)
+				{
+					for( std::size_t i = Batch * BatchSize; i < (Batch + 1) * BatchSize; ++i )
+					{
+						std::fill(Coverage.Pixels.begin(), Coverage.Pixels.end(), 0);
+						qTri::CrossProductMethod<qTri::CrossProductWidthExp2>(
+							FragCoords.data(), Coverage.Pixels.data(),
+							FragCoords.size(), Triangles[i]
+						);
+						for( std::size_t j = 0; j < Coverage.Pixels.size(); ++j )
+						{
+							if( Coverage.Pixels[j] )
+							{
+								TwoPass.Pixels[j] = static_cast<std::uint32_t>(i);
+							}
+						}
+					}
+				},
+				TriangleCount / BatchSize, 0
+			)
+		)
+	);
+	Report(
+		"VisibilityView",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Batch)
+				{
+					qTri::VisibilityView(
+						qTri::BasicImageView<std::uint32_t>(Fused),
+						Triangles.data() + Batch * BatchSize, BatchSize,
+						static_cast<std::uint32_t>(Batch * BatchSize)
+					);
+				},
+				TriangleCount / BatchSize, 0
+			)
+		)
+	);
+	const std::size_t Covered = std::count_if(
+		Fused.Pixels.begin(), Fused.Pixels.end(),
+		[](std::uint32_t ID){ return ID != qTri::NoTriangle; }
+	);
+	std::printf("%zu of %zu pixels covered\n", Covered, Fused.Pixels.size());
+	if( Fused.Pixels != TwoPass.Pixels )
+	{
+		std::printf("Fused IDs differ from IDs written through coverage\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Opaque scene of the occlusion benchmark, each triangle covers about 5% of
+// the frame for an overdraw of around eight
+constexpr std::size_t OcclusionExtent = 512;
+constexpr std::size_t OcclusionTriangles = 160;
+constexpr std::size_t OcclusionFrames = 64;
+
+// Benchmark occlusion [Seed]
+// Compares drawing every triangle of an opaque scene into an ID buffer
+// against culling tiles and triangles behind what is already covered
+static int Occlusion(std::uint32_t Seed)
+{
+	std::mt19937 RandomEngine(Seed);
+	std::vector<std::vector<qTri::Triangle>> Scenes(OcclusionFrames);
+	for( std::vector<qTri::Triangle>& CurScene : Scenes )
+	{
+		CurScene.resize(OcclusionTriangles);
+		for( qTri::Triangle& CurTriangle : CurScene )
+		{
+			CurTriangle = CoverageTriangle<5>(
+				RandomEngine, OcclusionExtent, OcclusionExtent
+			);
+			SortClockwise(CurTriangle);
+		}
+	}
+	qTri::BasicImage<std::uint32_t> Drawn(OcclusionExtent, OcclusionExtent);
+	qTri::BasicImage<std::uint32_t> Culled(OcclusionExtent, OcclusionExtent);
+	qTri::OcclusionTiles Occlusion(OcclusionExtent, OcclusionExtent);
+	std::size_t Rejected = 0;
+	bool Matches = true;
+	const double TicksPerNs = TickClock::TicksPerNanosecond();
+	const auto Report = [&](const char* Name, const BenchStats& Stats)
+	{
+		std::printf("%s\t| %.1f us per frame\n", Name, Stats.Median / TicksPerNs * 1e-3);
+	};
+
+	std::printf(
+		"%zu x %zu IDs, %zu opaque triangles per frame\n",
+		OcclusionExtent, OcclusionExtent, OcclusionTriangles
+	);
+	Report(
+		"VisibilityView",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Frame)
+				{
+					std::fill(Drawn.Pixels.begin(), Drawn.Pixels.end(), qTri::NoTriangle);
+					qTri::VisibilityView(
+						qTri::BasicImageView<std::uint32_t>(Drawn),
+						Scenes[Frame].data(), OcclusionTriangles
+					);
+				},
+				OcclusionFrames, 1
+			)
+		)
+	);
+	Report(
+		"OpaqueVisibilityView",
+		BenchStats::From(
+			SampleBatches(
+				[&](std::size_t Frame)
+				{
+					std::fill(Culled.Pixels.begin(), Culled.Pixels.end(), qTri::NoTriangle);
+					Occlusion.Clear();
+					Rejected += qTri::OpaqueVisibilityView(
+						qTri::BasicImageView<std::uint32_t>(Culled), Occlusion,
+						Scenes[Frame].data(), OcclusionTriangles
+					);
+					// Only the last frame is left to compare against
+					if( Frame + 1 == OcclusionFrames )
+					{
+						Matches = Culled.Pixels == Drawn.Pixels;
+					}
+				},
+				OcclusionFrames, 0
+			)
+		)
+	);
+	std::printf(
+		"%.1f%% of triangles rejected outright\n",
+		100.0 * Rejected / (OcclusionFrames * OcclusionTriangles)
+	);
+	if( !Matches )
+	{
+		std::printf("Culled IDs differ from drawing every triangle\n");
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+// Default slowdown of the fastest batch in percent that counts as a
+// regression
+constexpr double DefaultThreshold = 5.0;
+// Recorded and compared results keep the fastest of several runs of each
+// algorithm
+constexpr std::size_t RecordRuns = 3;
+// Algorithms slower than the baseline are measured again up to this many
+// times, a pause apart, before the slowdown counts. Load on the machine
+// rarely lasts through all of them.
+constexpr std::size_t RegressRechecks = 5;
+constexpr std::chrono::milliseconds RecheckPause{500};
+
+// Benchmark [counters] [Seed]
+// Benchmark record ResultPath [Seed]
+// Benchmark regress BaselinePath [ThresholdPercent] [Seed]
+//     Records the baseline instead if it does not exist yet
+// Benchmark compare BaselinePath ResultPath [ThresholdPercent]
+// Benchmark sweep [csv|json] [Seed]
+// Benchmark autotune Width Height TriangleSize [CachePath]
+// Benchmark compact [Seed]
+// Benchmark query [Seed]
+// Benchmark overwrite
+// Benchmark blend [Seed]
+// Benchmark visibility [Seed]
+// Benchmark occlusion [Seed]
+int main(int argc, char* argv[])
+{
+	if( !PinThread() )
+	{
+		std::fprintf(stderr, "Unable to pin benchmark thread\n");
+	}
+
+	if( argc > 1 && std::strcmp(argv[1], "sweep") == 0 )
+	{
+		const bool JSON = argc > 2 && std::strcmp(argv[2], "json") == 0;
+		const std::uint32_t Seed = argc > 3 ? std::stoul(argv[3], nullptr, 0) : DefaultSeed;
+		return Sweep(JSON, Seed);
+	}
+
+	const std::string Mode = argc > 1 ? argv[1] : "";
+	if( Mode == "compact" )
+	{
+		return Compact(argc > 2 ? std::stoul(argv[2], nullptr, 0) : DefaultSeed);
+	}
+	if( Mode == "query" )
+	{
+		return Query(argc > 2 ? std::stoul(argv[2], nullptr, 0) : DefaultSeed);
+	}
+	if( Mode == "overwrite" )
+	{
+		return Overwrite();
+	}
+	if( Mode == "blend" )
+	{
+		return Blend(argc > 2 ? std::stoul(argv[2], nullptr, 0) : DefaultSeed);
+	}
+	if( Mode == "visibility" )
+	{
+		return Visibility(argc > 2 ? std::stoul(argv[2], nullptr, 0) : DefaultSeed);
+	}
+	if( Mode == "occlusion" )
+	{
+		return Occlusion(argc > 2 ? std::stoul(argv[2], nullptr, 0) : DefaultSeed);
+	}
+
+	if( Mode == "compare" )
+	{
+		std::vector<BenchRecord> Baseline, Current;
+		if( argc < 4 || !ReadRecords(argv[2], Baseline) || !ReadRecords(argv[3], Current) )
+		{
+			std::fprintf(stderr, "Unable to read benchmark results\n");
+			return EXIT_FAILURE;
+		}
+		const double Threshold = argc > 4 ? std::stod(argv[4]) : DefaultThreshold;
+		return CompareRecords(Baseline, Current, Threshold) ? EXIT_FAILURE : EXIT_SUCCESS;
+	}
+
+	if( Mode == "autotune" && argc > 4 )
+	{
+		const qTri::Workload Shape{
+			std::stoull(argv[2]), std::stoull(argv[3]), std::stoull(argv[4]),
+			static_cast<std::int32_t>(
+				std::max(std::stoull(argv[2]), std::stoull(argv[3]))
+			),
+			false
+		};
+		for( const qTri::FillKernel* CurKernel : qTri::EligibleKernels(Shape) )
+		{
+			std::printf(
+				"%s\t| %s\t| %zu wide\t| +-%d\t| %s edges\n",
+				CurKernel->Name, CurKernel->ISA, CurKernel->Width,
+				CurKernel->CoordinateLimit,
+				CurKernel->InclusiveEdges ? "Inclusive" : "Half-open"
+			);
+		}
+		const qTri::FillKernel* Fastest = qTri::Autotune(
+			Shape, argc > 5 ? argv[5] : nullptr
+		);
+		std::printf("Fastest: %s\n", Fastest ? Fastest->Name : "none");
+		return Fastest ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	const bool Counters = Mode == "counters";
+	const bool Record = Mode == "record" && argc > 2;
+	const bool Regress = Mode == "regress" && argc > 2;
+	const double Threshold = Regress && argc > 3 ? std::stod(argv[3]) : DefaultThreshold;
+	const int SeedArg = Regress ? 4 : Record ? 3 : Counters ? 2 : 1;
+	const std::uint32_t Seed = argc > SeedArg ? std::stoul(argv[SeedArg], nullptr, 0) : DefaultSeed;
+	std::mt19937 RandomEngine(Seed);
+	std::vector<qTri::Triangle> Triangles(TriangleCount);
+	for( qTri::Triangle& CurTriangle : Triangles )
+	{
+		// Randomly place vertices
+		CurTriangle = TriangleShapes[0].first(RandomEngine, Width, Height);
+		SortClockwise(CurTriangle);
 	}
 	std::printf(
 		"%zu Triangles x %zu times\n"
-		"%zu x %zu Image map\n",
-		std::extent<decltype(Triangles)>::value,
+		"%zu x %zu Image map\n"
+		"Seed: 0x%08X\n",
+		TriangleCount,
 		Loops,
 		Width,
-		Height
+		Height,
+		Seed
 	);
 	std::printf(
-		"Algorithm | Average per triangle(ns)\n"
+		"%.3f ticks/ns\n",
+		TickClock::TicksPerNanosecond()
 	);
-	// Generate 2d grid of points to test against
-	std::vector<glm::i32vec2> FragCoords;
-	for( std::size_t y = 0; y < Height; ++y )
+
+	// Hardware counters of one more pass over all triangles, in the same row
+	// as the timings of each algorithm
+	std::optional<PerfCounters> Counter;
+	if( Counters )
 	{
-		for( std::size_t x = 0; x < Width; ++x )
+		Counter.emplace();
+		if( !Counter->AnyAvailable() )
 		{
-			FragCoords.emplace_back(x,y);
+			std::printf("Performance counters unavailable\n");
+			Counter.reset();
 		}
 	}
-	// Benchmark each algorithm against all triangles
-	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+	// Misses are normalized per thousand points tested
+	constexpr PerfCounters::Counter Misses[] = {
+		PerfCounters::L1DMisses,
+		PerfCounters::LLCMisses,
+		PerfCounters::BranchMisses
+	};
+	std::printf(
+		"Algorithm | Median per triangle(ns) | P99 per triangle(ns)"
+		" | StdDev per triangle(ns) | Ticks per point"
+	);
+	if( Counter )
 	{
 		std::printf(
-			"%s\t",
-			FillAlgorithm.second
+			" | %s per point | %s | IPC",
+			PerfCounters::Name(PerfCounters::Cycles),
+			PerfCounters::Name(PerfCounters::Cycles)
 		);
+		for( const PerfCounters::Counter CurCounter : Misses )
+		{
+			std::printf(" | %s per 1000 points", PerfCounters::Name(CurCounter));
+		}
+	}
+	std::printf("\n");
+
+	const qTri::PointBuffer FragCoords = GenerateGrid(Width, Height);
+	const double Points = static_cast<double>(TriangleCount) * FragCoords.size();
+	std::vector<BenchRecord> Records;
+	const std::size_t Runs = Record || Regress ? RecordRuns : 1;
+	// Measures each algorithm again by the index of its record
+	std::vector<std::function<BenchStats()>> Remeasure;
+	const auto Report = [&](const auto& FillAlgorithm)
+	{
 		qTri::Image CurFrame(Width, Height);
-		std::size_t ExecTime = 0;
-		for( std::size_t i = 0; i < Loops; ++i)
+		Remeasure.push_back(
+			[&, FillAlgorithm]() -> BenchStats
+			{
+				qTri::Image Frame(Width, Height);
+				return Measure(
+					FillAlgorithm, FragCoords, Frame.Pixels.data(),
+					Triangles, BatchSize, Loops
+				);
+			}
+		);
+		BenchStats Stats = Remeasure.back()();
+		for( std::size_t Run = 1; Run < Runs; ++Run )
 		{
-			for( const qTri::Triangle& CurTriangle : Triangles )
+			const BenchStats CurStats = Remeasure.back()();
+			if( CurStats.Min < Stats.Min )
 			{
-				ExecTime += Bench<>::Duration(
-					FillAlgorithm.first,
-					FragCoords.data(),
-					CurFrame.Pixels.data(),
-					FragCoords.size(),
-					CurTriangle
-				).count();
+				Stats = CurStats;
 			}
 		}
-		ExecTime /= std::extent<decltype(Triangles)>::value * Loops;
+		Records.push_back(
+			BenchRecord{
+				FillAlgorithm.Name, FillAlgorithm.ISA,
+				Width, Height, TriangleCount, Seed, Stats
+			}
+		);
 		std::printf(
-			"| %zu ns\n",
-			ExecTime
+			"%s\t| %.1f ns\t| %.1f ns\t| %.1f ns\t| %.3f",
+			FillAlgorithm.Name,
+			Stats.Median,
+			Stats.P99,
+			Stats.StdDev,
+			Stats.Median * TickClock::TicksPerNanosecond() / FragCoords.size()
 		);
+		if( !Counter )
+		{
+			std::printf("\n");
+			return;
+		}
+
+		Counter->Start();
+		for( const qTri::Triangle& CurTriangle : Triangles )
+		{
+			FillAlgorithm.Fill(
+				FragCoords.data(),
+				CurFrame.Pixels.data(),
+				FragCoords.size(),
+				CurTriangle
+			);
+		}
+		const auto Counts = Counter->Stop();
+		if( Counter->Available(PerfCounters::Cycles) )
+		{
+			std::printf(
+				"\t| %.3f\t| %.0f",
+				Counts[PerfCounters::Cycles] / Points,
+				Counts[PerfCounters::Cycles]
+			);
+		}
+		else
+		{
+			std::printf("\t| n/a\t| n/a");
+		}
+		if(
+			Counter->Available(PerfCounters::Cycles)
+			&& Counter->Available(PerfCounters::Instructions)
+		)
+		{
+			std::printf(
+				"\t| %.2f",
+				Counts[PerfCounters::Instructions] / Counts[PerfCounters::Cycles]
+			);
+		}
+		else
+		{
+			std::printf("\t| n/a");
+		}
+		for( const PerfCounters::Counter CurCounter : Misses )
+		{
+			if( Counter->Available(CurCounter) )
+			{
+				std::printf("\t| %.3f", Counts[CurCounter] * 1000.0 / Points);
+			}
+			else
+			{
+				std::printf("\t| n/a");
+			}
+		}
+		std::printf("\n");
+	};
+	// Benchmark each algorithm against all triangles
+	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+	{
+		Report(FillAlgorithm);
+	}
+	// The widest Cross-Product kernel instantiated in place, inlined with a
+	// constant point count rather than called through FillAlgorithms
+	const auto InlineFill = [](
+		const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t,
+		const qTri::Triangle& Tri
+	)
+	{
+		qTri::CrossProductMethod<qTri::CrossProductWidthExp2>(
+			Points, Results, Width * Height, Tri
+		);
+	};
+	const struct
+	{
+		decltype(InlineFill) Fill;
+		const char* Name;
+		const char* ISA;
+	} InlineKernel = {InlineFill, "Inline-CrossProduct", qTri::CrossProductISA};
+	Report(InlineKernel);
+	// Coverage masks handed to a visitor fused into the kernel
+	const auto VisitFill = [](
+		const glm::i32vec2 Points[], std::uint8_t Results[], std::size_t,
+		const qTri::Triangle& Tri
+	)
+	{
+		qTri::CrossProductVisitBlocks(
+			Points, Width * Height, Tri,
+			[Results](std::size_t Index, std::uint32_t Mask)
+			{
+				for( ; Mask; Mask &= Mask - 1 )
+				{
+					Results[Index + qTri::LowestBit(Mask)] |= 1;
+				}
+			}
+		);
+	};
+	const struct
+	{
+		decltype(VisitFill) Fill;
+		const char* Name;
+		const char* ISA;
+	} VisitKernel = {VisitFill, "Visit-CrossProduct", qTri::CrossProductISA};
+	Report(VisitKernel);
+
+	if( Record || Regress )
+	{
+		// A baseline is only recorded when there is none yet, one that fails
+		// to parse is reported rather than replaced
+		std::vector<BenchRecord> Baseline;
+		const bool BaselineExists = Regress && std::ifstream(argv[2]).good();
+		if(
+			BaselineExists
+			&& (!ReadRecords(argv[2], Baseline) || Baseline.empty())
+		)
+		{
+			std::fprintf(stderr, "Unable to read baseline %s\n", argv[2]);
+			return EXIT_FAILURE;
+		}
+		if( Record || !BaselineExists )
+		{
+			if( !WriteRecords(argv[2], Records) )
+			{
+				std::fprintf(stderr, "Unable to write %s\n", argv[2]);
+				return EXIT_FAILURE;
+			}
+			std::printf("Recorded %s\n", argv[2]);
+			return EXIT_SUCCESS;
+		}
+		for( std::size_t Recheck = 0; Recheck < RegressRechecks; ++Recheck )
+		{
+			std::vector<std::size_t> Slower;
+			for( std::size_t i = 0; i < Records.size(); ++i )
+			{
+				const BenchRecord* BaseRecord = FindRecord(Baseline, Records[i].Algorithm);
+				if(
+					BaseRecord != nullptr && SameParameters(*BaseRecord, Records[i])
+					&& MinChange(*BaseRecord, Records[i]) > Threshold
+				)
+				{
+					Slower.push_back(i);
+				}
+			}
+			if( Slower.empty() )
+			{
+				break;
+			}
+			std::this_thread::sleep_for(RecheckPause);
+			for( const std::size_t CurIndex : Slower )
+			{
+				const BenchStats CurStats = Remeasure[CurIndex]();
+				if( CurStats.Min < Records[CurIndex].Stats.Min )
+				{
+					Records[CurIndex].Stats = CurStats;
+				}
+			}
+		}
+		WriteRecords((std::string(argv[2]) + ".latest").c_str(), Records);
+		return CompareRecords(Baseline, Records, Threshold) ? EXIT_FAILURE : EXIT_SUCCESS;
 	}
+
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Cache.hpp>
+#include <qTriangle/Kernels.hpp>
+
+#include "Triangles.hpp"
+
+constexpr std::size_t Width = 80;
+constexpr std::size_t Height = 50;
+// Distinct shapes in the traffic
+constexpr std::size_t ShapeCount = 64;
+constexpr std::size_t Draws = 100'000;
+// Draws composited into each frame before it is checked
+constexpr std::size_t DrawsPerFrame = 16;
+
+// Draws the same few shapes at random places across the grid, some of them
+// clipped by its edges and some too large to be cached, and checks that the
+// cache matches filling every triangle directly
+int main()
+{
+	std::mt19937 RandomEngine(0xCAC4E);
+	std::vector<qTri::Triangle> Shapes(ShapeCount);
+	for( qTri::Triangle& CurShape : Shapes )
+	{
+		CurShape = RandomTriangle(RandomEngine, glm::i32vec2(0), glm::i32vec2(12));
+	}
+	// Larger than the cache takes
+	Shapes.push_back(
+		qTri::Triangle{{{-200, -200}, {300, -200}, {-200, 300}}}
+	);
+
+	std::uniform_int_distribution<std::size_t> ShapeDis(0, ShapeCount);
+	std::uniform_int_distribution<std::int32_t> WidthDis(-12, Width);
+	std::uniform_int_distribution<std::int32_t> HeightDis(-12, Height);
+	std::vector<qTri::Triangle> Triangles(Draws);
+	for( qTri::Triangle& CurTriangle : Triangles )
+	{
+		const glm::i32vec2 Position(WidthDis(RandomEngine), HeightDis(RandomEngine));
+		CurTriangle = Shapes[ShapeDis(RandomEngine)];
+		for( glm::i32vec2& CurVert : CurTriangle )
+		{
+			CurVert += Position;
+		}
+	}
+
+	const qTri::FillFunction Fill = qTri::CrossProductMethod<qTri::CrossProductWidthExp2>;
+	std::size_t Failures = 0;
+	// Holds every shape, and holds a fraction of them
+	for( const std::size_t Capacity : {ShapeCount, ShapeCount / 4} )
+	{
+		qTri::CoverageCache Cache(Capacity, Fill);
+		qTri::Image Direct(Width, Height);
+		qTri::Image Cached(Width, Height);
+		std::chrono::nanoseconds DirectTime{0};
+		std::chrono::nanoseconds CachedTime{0};
+		std::size_t Mismatches = 0;
+		for( std::size_t Frame = 0; Frame < Draws; Frame += DrawsPerFrame )
+		{
+			std::fill(Direct.Pixels.begin(), Direct.Pixels.end(), 0);
+			std::fill(Cached.Pixels.begin(), Cached.Pixels.end(), 0);
+			auto Start = std::chrono::steady_clock::now();
+			for( std::size_t i = Frame; i < Frame + DrawsPerFrame; ++i )
+			{
+				qTri::FillView(qTri::ImageView(Direct), Triangles[i], Fill);
+			}
+			DirectTime += std::chrono::steady_clock::now() - Start;
+			Start = std::chrono::steady_clock::now();
+			for( std::size_t i = Frame; i < Frame + DrawsPerFrame; ++i )
+			{
+				Cache.FillView(qTri::ImageView(Cached), Triangles[i]);
+			}
+			CachedTime += std::chrono::steady_clock::now() - Start;
+			for( std::size_t i = 0; i < Direct.Pixels.size(); ++i )
+			{
+				Mismatches += Direct.Pixels[i] != Cached.Pixels[i];
+			}
+		}
+		const qTri::CoverageCache::Counters& Stats = Cache.Stats();
+		std::printf(
+			"Capacity %zu\t| Direct %.1f ns\t| Cached %.1f ns per triangle\n"
+			"\t| %.1f%% hits, %zu misses, %zu evictions, %zu bypasses\t| %zu mismatches\n",
+			Capacity,
+			std::chrono::duration<double, std::nano>(DirectTime).count() / Draws,
+			std::chrono::duration<double, std::nano>(CachedTime).count() / Draws,
+			100.0 * Stats.HitRate(), Stats.Misses, Stats.Evictions, Stats.Bypasses,
+			Mismatches
+		);
+		Failures += Mismatches;
+	}
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
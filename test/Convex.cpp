@@ -0,0 +1,165 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
+
+// Odd so that rows end in a partial block of points
+constexpr std::size_t Width = 509;
+constexpr std::size_t Height = 509;
+constexpr std::size_t PolygonCount = 64;
+
+// Random convex polygons of N vertices, from sorted angles around an ellipse
+// Rounding may fold a vertex inwards, those polygons are drawn again
+template<std::size_t N>
+static std::vector<qTri::ConvexPolygon<N>> RandomPolygons(std::mt19937& RandomEngine)
+{
+	std::uniform_real_distribution<glm::float32_t> AngleDis(0.0f, glm::two_pi<glm::float32_t>());
+	std::uniform_real_distribution<glm::float32_t> RadiusDis(16.0f, Width / 2.0f);
+	std::vector<qTri::ConvexPolygon<N>> Polygons;
+	while( Polygons.size() < PolygonCount )
+	{
+		glm::float32_t Angles[N];
+		for( glm::float32_t& CurAngle : Angles )
+		{
+			CurAngle = AngleDis(RandomEngine);
+		}
+		std::sort(std::begin(Angles), std::end(Angles));
+		const glm::vec2 Radius(RadiusDis(RandomEngine), RadiusDis(RandomEngine));
+		qTri::ConvexPolygon<N> CurPolygon;
+		for( std::size_t i = 0; i < N; ++i )
+		{
+			CurPolygon[i] = glm::i32vec2(
+				glm::vec2(Width / 2.0f, Height / 2.0f)
+				+ Radius * glm::vec2(glm::cos(Angles[i]), glm::sin(Angles[i]))
+			);
+		}
+		bool Convex = true;
+		for( std::size_t i = 0; i < N; ++i )
+		{
+			Convex &= qTri::Det(
+				CurPolygon[(i + 1) % N] - CurPolygon[i],
+				CurPolygon[(i + 2) % N] - CurPolygon[(i + 1) % N]
+			) > 0;
+		}
+		if( Convex )
+		{
+			Polygons.push_back(CurPolygon);
+		}
+	}
+	return Polygons;
+}
+
+// Tests each polygon with the convex kernel and as a fan of N - 2 triangles
+// with the Cross-Product kernel, and checks that both cover the same points
+template<std::size_t N>
+static std::size_t Check(
+	const std::vector<qTri::ConvexPolygon<N>>& Polygons, const char* Name,
+	const std::vector<glm::i32vec2>& Points
+)
+{
+	const qTri::FillFunction Fill = qTri::CrossProductMethod<qTri::CrossProductWidthExp2>;
+	std::vector<std::uint8_t> Convex(Points.size());
+	std::vector<std::uint8_t> Fan(Points.size());
+	qTri::Image ConvexView(Width, Height);
+	qTri::Image FanView(Width, Height);
+	std::chrono::nanoseconds ConvexTime{0};
+	std::chrono::nanoseconds FanTime{0};
+	std::size_t Mismatches = 0;
+	for( const qTri::ConvexPolygon<N>& CurPolygon : Polygons )
+	{
+		std::fill(Convex.begin(), Convex.end(), 0);
+		std::fill(Fan.begin(), Fan.end(), 0);
+		auto Start = std::chrono::steady_clock::now();
+		qTri::ConvexMethod(Points.data(), Convex.data(), Points.size(), CurPolygon);
+		ConvexTime += std::chrono::steady_clock::now() - Start;
+		Start = std::chrono::steady_clock::now();
+		for( std::size_t i = 1; i + 1 < N; ++i )
+		{
+			Fill(
+				Points.data(), Fan.data(), Points.size(),
+				{{CurPolygon[0], CurPolygon[i], CurPolygon[i + 1]}}
+			);
+		}
+		FanTime += std::chrono::steady_clock::now() - Start;
+		for( std::size_t i = 0; i < Points.size(); ++i )
+		{
+			Mismatches += Convex[i] != Fan[i];
+		}
+
+		// Through views, against the triangles of the fan
+		std::fill(ConvexView.Pixels.begin(), ConvexView.Pixels.end(), 0);
+		std::fill(FanView.Pixels.begin(), FanView.Pixels.end(), 0);
+		qTri::FillView(qTri::ImageView(ConvexView), CurPolygon);
+		for( std::size_t i = 1; i + 1 < N; ++i )
+		{
+			qTri::FillView(
+				qTri::ImageView(FanView),
+				qTri::Triangle{{CurPolygon[0], CurPolygon[i], CurPolygon[i + 1]}}
+			);
+		}
+		for( std::size_t i = 0; i < ConvexView.Pixels.size(); ++i )
+		{
+			Mismatches += ConvexView.Pixels[i] != FanView.Pixels[i];
+		}
+	}
+	std::printf(
+		"%s\t| %zu polygons\t| Convex %.1f us\t| Fan %.1f us per polygon\t"
+		"| %zu mismatches\n",
+		Name, Polygons.size(),
+		std::chrono::duration<double, std::micro>(ConvexTime).count() / Polygons.size(),
+		std::chrono::duration<double, std::micro>(FanTime).count() / Polygons.size(),
+		Mismatches
+	);
+	return Mismatches;
+}
+
+// Quads, pentagons, hexagons and octagons against their triangle fans, along
+// with axis aligned rectangles whose edges lie along rows and columns of points
+int main()
+{
+	std::mt19937 RandomEngine(0xC0417E8);
+
+	// Generate 2d grid of points to test against
+	std::vector<glm::i32vec2> Points;
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		for( std::size_t x = 0; x < Width; ++x )
+		{
+			Points.emplace_back(x, y);
+		}
+	}
+
+	std::uniform_int_distribution<std::int32_t> CornerDis(-8, Width + 8);
+	std::vector<qTri::ConvexPolygon<4>> Rectangles;
+	while( Rectangles.size() < PolygonCount )
+	{
+		const glm::i32vec2 A(CornerDis(RandomEngine), CornerDis(RandomEngine));
+		const glm::i32vec2 B(CornerDis(RandomEngine), CornerDis(RandomEngine));
+		const glm::i32vec2 Min = glm::min(A, B);
+		const glm::i32vec2 Max = glm::max(A, B);
+		if( Min.x == Max.x || Min.y == Max.y )
+		{
+			continue;
+		}
+		Rectangles.push_back(
+			{{Min, glm::i32vec2(Max.x, Min.y), Max, glm::i32vec2(Min.x, Max.y)}}
+		);
+	}
+
+	std::size_t Failures = 0;
+	Failures += Check(Rectangles, "Rectangle", Points);
+	Failures += Check(RandomPolygons<4>(RandomEngine), "Quad", Points);
+	Failures += Check(RandomPolygons<5>(RandomEngine), "Pentagon", Points);
+	Failures += Check(RandomPolygons<6>(RandomEngine), "Hexagon", Points);
+	Failures += Check(RandomPolygons<8>(RandomEngine), "Octagon", Points);
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,180 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Depth.hpp>
+#include <qTriangle/Kernels.hpp>
+
+#include "Triangles.hpp"
+
+constexpr std::size_t Width = 256;
+constexpr std::size_t Height = 256;
+constexpr std::size_t TriangleCount = 2'000;
+
+struct DepthTriangle
+{
+	qTri::Triangle Tri;
+	std::array<double,3> Depths;
+};
+
+// Depth of the plane of Tri at Point in double precision
+static double PlaneDepth(const DepthTriangle& CurTriangle, const glm::i32vec2& Point)
+{
+	const qTri::Triangle& Tri = CurTriangle.Tri;
+	const double Area = qTri::Det(Tri[1] - Tri[0], Tri[2] - Tri[0]);
+	const double U = qTri::Det(Tri[2] - Tri[0], Point - Tri[0]) / -Area;
+	const double V = qTri::Det(Tri[1] - Tri[0], Point - Tri[0]) / Area;
+	return CurTriangle.Depths[0]
+		+ U * (CurTriangle.Depths[1] - CurTriangle.Depths[0])
+		+ V * (CurTriangle.Depths[2] - CurTriangle.Depths[0]);
+}
+
+// Renders overlapping triangles with depth testing and checks that every
+// pixel holds the nearest depth of the triangles covering it, and that the
+// triangle IDs resolved by depth name a triangle at that depth
+template<typename DepthT>
+static std::size_t Check(
+	const std::vector<DepthTriangle>& Triangles, double Tolerance, const char* Name
+)
+{
+	std::vector<glm::i32vec2> FragCoords;
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		for( std::size_t x = 0; x < Width; ++x )
+		{
+			FragCoords.emplace_back(x, y);
+		}
+	}
+	// Depth test against the nearest depth in double precision
+	std::vector<double> Nearest(
+		FragCoords.size(), std::numeric_limits<double>::infinity()
+	);
+	std::vector<std::uint8_t> Covered(FragCoords.size());
+	for( const DepthTriangle& CurTriangle : Triangles )
+	{
+		std::fill(Covered.begin(), Covered.end(), 0);
+		// Serial-Barycentric shares the coverage rules of DepthFill
+		qTri::BarycentricMethod<0>(
+			FragCoords.data(), Covered.data(), FragCoords.size(), CurTriangle.Tri
+		);
+		for( std::size_t i = 0; i < FragCoords.size(); ++i )
+		{
+			if( Covered[i] )
+			{
+				Nearest[i] = std::min(Nearest[i], PlaneDepth(CurTriangle, FragCoords[i]));
+			}
+		}
+	}
+
+	qTri::Image Coverage(Width, Height);
+	qTri::DepthBuffer<DepthT> Buffer(Width, Height);
+	const auto Start = std::chrono::steady_clock::now();
+	for( const DepthTriangle& CurTriangle : Triangles )
+	{
+		qTri::DepthFill(
+			Coverage, Buffer, CurTriangle.Tri,
+			{
+				static_cast<DepthT>(CurTriangle.Depths[0]),
+				static_cast<DepthT>(CurTriangle.Depths[1]),
+				static_cast<DepthT>(CurTriangle.Depths[2])
+			}
+		);
+	}
+	const auto Duration = std::chrono::steady_clock::now() - Start;
+
+	qTri::BasicImage<std::uint32_t> IDs(Width, Height);
+	std::fill(IDs.Pixels.begin(), IDs.Pixels.end(), qTri::NoTriangle);
+	qTri::DepthBuffer<DepthT> IDBuffer(Width, Height);
+	for( std::size_t i = 0; i < Triangles.size(); ++i )
+	{
+		qTri::DepthVisibility(
+			IDs, IDBuffer, Triangles[i].Tri,
+			{
+				static_cast<DepthT>(Triangles[i].Depths[0]),
+				static_cast<DepthT>(Triangles[i].Depths[1]),
+				static_cast<DepthT>(Triangles[i].Depths[2])
+			},
+			static_cast<std::uint32_t>(i)
+		);
+	}
+
+	std::size_t Mismatches = 0;
+	for( std::size_t i = 0; i < FragCoords.size(); ++i )
+	{
+		const bool Expected = Nearest[i] != std::numeric_limits<double>::infinity();
+		Mismatches += Coverage.Pixels[i] != Expected;
+		if( Expected )
+		{
+			Mismatches += std::abs(Buffer.Depth.Pixels[i] - Nearest[i]) > Tolerance;
+		}
+		// Resolving IDs tests depth exactly as filling does
+		Mismatches += IDBuffer.Depth.Pixels[i] != Buffer.Depth.Pixels[i];
+		const std::uint32_t ID = IDs.Pixels[i];
+		if( ID == qTri::NoTriangle || !Expected )
+		{
+			Mismatches += (ID == qTri::NoTriangle) == Expected;
+			continue;
+		}
+		Mismatches += ID >= Triangles.size() || std::abs(
+			PlaneDepth(Triangles[ID], FragCoords[i]) - Nearest[i]
+		) > Tolerance * 2;
+	}
+	std::printf(
+		"%s\t| %.1f ns per triangle\t| %zu mismatches\n",
+		Name,
+		std::chrono::duration<double, std::nano>(Duration).count() / Triangles.size(),
+		Mismatches
+	);
+	return Mismatches;
+}
+
+// Depth tests triangles in submission, front-to-back and back-to-front order
+// for each depth format
+int main()
+{
+	std::mt19937 RandomEngine(0xDE9754);
+	std::uniform_int_distribution<std::int32_t> DepthDis(0, 60000);
+	std::vector<DepthTriangle> Triangles(TriangleCount);
+	for( DepthTriangle& CurTriangle : Triangles )
+	{
+		CurTriangle.Tri = RandomTriangle(
+			RandomEngine, glm::i32vec2(-16), glm::i32vec2(Width + 16, Height + 16)
+		);
+		// Mostly flat layers with some slope
+		const std::int32_t Layer = DepthDis(RandomEngine);
+		for( double& CurDepth : CurTriangle.Depths )
+		{
+			CurDepth = std::min(Layer + DepthDis(RandomEngine) / 16, 65535);
+		}
+	}
+
+	std::size_t Failures = 0;
+	// Quantization and single precision interpolation
+	constexpr double Tolerance16 = 1.0;
+	constexpr double Tolerance32 = 0.05;
+	Failures += Check<std::uint16_t>(Triangles, Tolerance16, "Submission-16");
+	Failures += Check<float>(Triangles, Tolerance32, "Submission-32F");
+	const auto NearestVertex = [](const DepthTriangle& A, const DepthTriangle& B)
+	{
+		return *std::min_element(A.Depths.begin(), A.Depths.end())
+			< *std::min_element(B.Depths.begin(), B.Depths.end());
+	};
+	std::sort(Triangles.begin(), Triangles.end(), NearestVertex);
+	Failures += Check<std::uint16_t>(Triangles, Tolerance16, "FrontToBack-16");
+	Failures += Check<float>(Triangles, Tolerance32, "FrontToBack-32F");
+	std::reverse(Triangles.begin(), Triangles.end());
+	Failures += Check<std::uint16_t>(Triangles, Tolerance16, "BackToFront-16");
+	Failures += Check<float>(Triangles, Tolerance32, "BackToFront-32F");
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -91,14 +91,14 @@ int main()
 	{
 		std::printf(
 			"%s - ",
-			FillAlgorithm.second
+			FillAlgorithm.Name
 		);
 		qTri::Image CurFrame(Width, Height);
 		std::size_t ExecTime = 0;
 		for( const qTri::Triangle& CurTriangle : Triangles )
 		{
 			ExecTime += Bench<>::Duration(
-				FillAlgorithm.first,
+				FillAlgorithm.Fill,
 				FragCoords.data(),
 				CurFrame.Pixels.data(),
 				FragCoords.size(),
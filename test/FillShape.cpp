@@ -1,17 +1,19 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <type_traits>
+#include <cstdio>
 #include <algorithm>
-#include <numeric>
+#include <cstring>
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
 
 #include <glm/glm.hpp>
-#include <glm/gtc/constants.hpp>
-#include <glm/trigonometric.hpp>
 
 #include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
+#include <qTriangle/Polygon.hpp>
+
+#include "FrameWriter.hpp"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb_image_write.h"
@@ -19,22 +21,31 @@ namespace fs = std::experimental::filesystem;
 constexpr std::size_t Width = 300;
 constexpr std::size_t Height = 300;
 
-int main()
+// FillShape [png|pgm|pbm]
+int main(int argc, char* argv[])
 {
-	// "a"
-	const glm::i32vec2 Edges[] = {
-		glm::i32vec2{235,152},
-		glm::i32vec2{176,165},
-		glm::i32vec2{144,173},
-		glm::i32vec2{129,184},
-		glm::i32vec2{124,202},
-		glm::i32vec2{135,226},
-		glm::i32vec2{168,235},
-		glm::i32vec2{206,226},
-		glm::i32vec2{230,201},
-		glm::i32vec2{236,165},
-		glm::i32vec2{235,152},
+	FrameWriter::Format OutputFormat = FrameWriter::Format::PNG;
+	if( argc > 1 )
+	{
+		if( std::strcmp(argv[1], "pgm") == 0 )
+		{
+			OutputFormat = FrameWriter::Format::PGM;
+		}
+		else if( std::strcmp(argv[1], "pbm") == 0 )
+		{
+			OutputFormat = FrameWriter::Format::PBM;
+		}
+		else if( std::strcmp(argv[1], "png") != 0 )
+		{
+			std::fprintf(stderr, "Usage: FillShape [png|pgm|pbm]\n");
+			return EXIT_FAILURE;
+		}
+	}
+	// Frames are encoded in the background while the next one renders
+	FrameWriter Writer(Width, Height, OutputFormat);
 
+	// "a", its counter is a hole
+	const qTri::Contour Outline = {
 		glm::i32vec2{238,233},
 		glm::i32vec2{200,257},
 		glm::i32vec2{159,264},
@@ -62,103 +73,79 @@ int main()
 		glm::i32vec2{274,233},
 		glm::i32vec2{283,259},
 		glm::i32vec2{246,259},
-		glm::i32vec2{238,233},
+	};
+	const qTri::Contour Counter = {
+		glm::i32vec2{235,152},
+		glm::i32vec2{176,165},
+		glm::i32vec2{144,173},
+		glm::i32vec2{129,184},
+		glm::i32vec2{124,202},
+		glm::i32vec2{135,226},
+		glm::i32vec2{168,235},
+		glm::i32vec2{206,226},
+		glm::i32vec2{230,201},
+		glm::i32vec2{236,165},
 	};
 
-	qTri::Triangle Triangles[std::extent<decltype(Edges)>::value];
+	// Triangles of the glyph do not overlap, so each one is simply added to
+	// the frame rather than inverting it
+	const std::vector<qTri::Triangle> Triangles = qTri::Triangulate(
+		Outline, {Counter}
+	);
 
-	for( std::size_t i = 0; i < std::extent<decltype(Edges)>::value; ++i )
-	{
-		Triangles[i] = qTri::Triangle{
-			{
-				{0, 0},
-				Edges[i],
-				Edges[(i + 1) % std::extent<decltype(Edges)>::value]
-			}
-		};
-		const glm::i32vec2 Center = std::accumulate(
-			std::cbegin(Triangles[i]),
-			std::cend(Triangles[i]),
-			glm::i32vec2{0,0}
-		) / 3;
-		std::sort(
-			std::begin(Triangles[i]),
-			std::end(Triangles[i]),
-			[&Center](const glm::i32vec2& A, const glm::i32vec2& B) -> bool
-				{
-					// Sort points by its angle from the center
-					const glm::i32vec2 DirectionA = Center - A;
-					const glm::i32vec2 DirectionB = Center - B;
-					const auto AngleA = glm::atan<glm::float32_t>(DirectionA.y, DirectionA.x);
-					const auto AngleB = glm::atan<glm::float32_t>(DirectionB.y, DirectionB.x);
-					return AngleA < AngleB;
-				}
-		);
-	}
-	// Generate 2d grid of points to test against
-	std::vector<glm::i32vec2> FragCoords;
-	for( std::size_t y = 0; y < Height; ++y )
+	// Renders the glyph a triangle at a time into Folder with Fill, along
+	// with an image of each triangle on its own
+	const auto RenderFrames = [&](const fs::path& Folder, const auto& Fill)
 	{
-		for( std::size_t x = 0; x < Width; ++x )
+		fs::create_directories(Folder);
+		qTri::Image Frame(Width, Height);
+		for( std::size_t i = 0; i < Triangles.size(); ++i )
 		{
-			FragCoords.emplace_back(x,y);
+			// Append the triangle to the glyph
+			Fill(qTri::ImageView(Frame), Triangles[i]);
+			qTri::Image CurFrame = Writer.Acquire();
+			CurFrame.Pixels = Frame.Pixels;
+			Writer.Submit(
+				std::move(CurFrame),
+				(Folder / std::to_string(i)).string() + Writer.Extension()
+			);
+
+			// Write an image of the current triangle
+			qTri::Image CurMask = Writer.Acquire();
+			Fill(qTri::ImageView(CurMask), Triangles[i]);
+			Writer.Submit(
+				std::move(CurMask),
+				(Folder / ("Tri" + std::to_string(i))).string() + Writer.Extension()
+			);
+			// ffmpeg -f image2 -framerate 2 -i %d.png -vf "scale=iw*2:ih*2" -sws_flags neighbor Anim.gif
 		}
-	}
+	};
 
+	// Coverage of [0x00,0x01] from each kernel
 	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
 	{
 		std::printf(
 			"%s:\n",
-			FillAlgorithm.second
+			FillAlgorithm.Name
 		);
-		const auto FrameFolder = fs::path("Frames") / FillAlgorithm.second;
-		fs::create_directories(FrameFolder);
-		qTri::Image Frame(Width, Height);
-		std::size_t FrameIdx = 0;
-		for( const qTri::Triangle& CurTriangle : Triangles )
-		{
-			qTri::Image CurInversion(Width, Height);
-			// Render triangle to inversion mask
-			FillAlgorithm.first(
-				FragCoords.data(),
-				CurInversion.Pixels.data(),
-				FragCoords.size(),
-				CurTriangle
-			);
-
-			// Append inversion mask
-			for( std::size_t i = 0; i < Width * Height; ++i )
-			{
-				Frame.Pixels[i] = CurInversion.Pixels[i] ? ~Frame.Pixels[i] : Frame.Pixels[i];
-			}
-			stbi_write_png(
-				((FrameFolder / std::to_string(FrameIdx)).string() + ".png").c_str(),
-				Width,
-				Height,
-				1,
-				Frame.Pixels.data(),
-				0
-			);
-			
-			// Write an image of the current triangle
-			// Post-process from [0x00,0x01] to [0x00,0xFF]
-			// Compiler vectorization loves loops like this
-			for( std::size_t i = 0; i < Width * Height; ++i )
+		RenderFrames(
+			fs::path("Frames") / FillAlgorithm.Name,
+			[&FillAlgorithm](const qTri::ImageView& View, const qTri::Triangle& Tri)
 			{
-				CurInversion.Pixels[i] *= 0xFF;
+				qTri::FillView(View, Tri, FillAlgorithm.Fill);
 			}
-			stbi_write_png(
-				(FrameFolder / ("Tri" + std::to_string(FrameIdx) + ".png")).c_str(),
-				Width,
-				Height,
-				1,
-				CurInversion.Pixels.data(),
-				0
-			);
-			// ffmpeg -f image2 -framerate 2 -i %d.png -vf "scale=iw*2:ih*2" -sws_flags neighbor Anim.gif
-			++FrameIdx;
-		}
+		);
 	}
 
+	// Masks of [0x00,0xFF] written straight from the Cross-Product test
+	std::printf("Mask:\n");
+	RenderFrames(
+		fs::path("Frames") / "Mask",
+		[](const qTri::ImageView& View, const qTri::Triangle& Tri)
+		{
+			qTri::FillView(View, Tri, std::uint8_t(0xFF));
+		}
+	);
+
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,216 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <qTriangle/Types.hpp>
+
+#include "stb_image_write.h"
+
+// Encodes and writes frames on a pool of background threads
+// Frames are handed over through a bounded queue so rendering blocks only
+// when the encoders fall behind, and finished frames are recycled into a pool
+// so rendering never reallocates its images
+class FrameWriter
+{
+public:
+	// Any non-zero pixel is written white, so that coverage of [0x00,0x01]
+	// and masks of [0x00,0xFF] look the same
+	enum class Format
+	{
+		// Compressed 8-bit grayscale
+		PNG,
+		// Uncompressed 8-bit grayscale(P5)
+		PGM,
+		// Uncompressed 1-bit bitmap(P4)
+		PBM,
+	};
+
+	FrameWriter(
+		std::size_t Width, std::size_t Height, Format OutputFormat,
+		std::size_t ThreadCount = std::max(1u, std::thread::hardware_concurrency())
+	)
+		: Width(Width),
+		Height(Height),
+		OutputFormat(OutputFormat),
+		QueueDepth(ThreadCount * 2)
+	{
+		for( std::size_t i = 0; i < ThreadCount; ++i )
+		{
+			Encoders.emplace_back(&FrameWriter::EncodeThread, this);
+		}
+	}
+
+	// Waits for all queued frames to be written
+	~FrameWriter()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(QueueMutex);
+			Finished = true;
+		}
+		QueueNotEmpty.notify_all();
+		for( std::thread& CurEncoder : Encoders )
+		{
+			CurEncoder.join();
+		}
+	}
+
+	const char* Extension() const
+	{
+		switch( OutputFormat )
+		{
+		case Format::PNG: return ".png";
+		case Format::PGM: return ".pgm";
+		case Format::PBM: return ".pbm";
+		}
+		return "";
+	}
+
+	// Returns a cleared frame, recycled from previously written frames when
+	// possible
+	qTri::Image Acquire()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(PoolMutex);
+			if( !Pool.empty() )
+			{
+				qTri::Image Frame = std::move(Pool.back());
+				Pool.pop_back();
+				std::fill(Frame.Pixels.begin(), Frame.Pixels.end(), 0);
+				return Frame;
+			}
+		}
+		return qTri::Image(Width, Height);
+	}
+
+	// Queues a frame to be written to Path
+	void Submit(qTri::Image&& Frame, std::string Path)
+	{
+		std::unique_lock<std::mutex> Lock(QueueMutex);
+		QueueNotFull.wait(
+			Lock,
+			[this]() -> bool
+			{
+				return Queue.size() < QueueDepth;
+			}
+		);
+		Queue.push_back(Job{std::move(Frame), std::move(Path)});
+		Lock.unlock();
+		QueueNotEmpty.notify_one();
+	}
+
+private:
+	struct Job
+	{
+		qTri::Image Frame;
+		std::string Path;
+	};
+
+	void EncodeThread()
+	{
+		while( true )
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			QueueNotEmpty.wait(
+				Lock,
+				[this]() -> bool
+				{
+					return Finished || !Queue.empty();
+				}
+			);
+			if( Queue.empty() )
+			{
+				return;
+			}
+			Job CurJob = std::move(Queue.front());
+			Queue.pop_front();
+			Lock.unlock();
+			QueueNotFull.notify_one();
+
+			Encode(CurJob);
+
+			std::lock_guard<std::mutex> PoolLock(PoolMutex);
+			Pool.push_back(std::move(CurJob.Frame));
+		}
+	}
+
+	void Encode(Job& CurJob) const
+	{
+		if( OutputFormat != Format::PBM )
+		{
+			// Compiler vectorization loves loops like this
+			qTri::PixelBuffer& Pixels = CurJob.Frame.Pixels;
+			for( std::size_t i = 0; i < Pixels.size(); ++i )
+			{
+				Pixels[i] = Pixels[i] ? 0xFF : 0x00;
+			}
+		}
+
+		if( OutputFormat == Format::PNG )
+		{
+			stbi_write_png(
+				CurJob.Path.c_str(),
+				Width,
+				Height,
+				1,
+				CurJob.Frame.Pixels.data(),
+				CurJob.Frame.Stride
+			);
+			return;
+		}
+
+		std::FILE* File = std::fopen(CurJob.Path.c_str(), "wb");
+		if( File == nullptr )
+		{
+			return;
+		}
+		if( OutputFormat == Format::PGM )
+		{
+			std::fprintf(File, "P5\n%zu %zu\n255\n", Width, Height);
+			for( std::size_t y = 0; y < Height; ++y )
+			{
+				std::fwrite(CurJob.Frame.Row(y), 1, Width, File);
+			}
+		}
+		else
+		{
+			// Rows are packed MSB-first and padded to a whole byte
+			// PBM treats set bits as black
+			std::fprintf(File, "P4\n%zu %zu\n", Width, Height);
+			std::vector<std::uint8_t> Row((Width + 7) / 8);
+			for( std::size_t y = 0; y < Height; ++y )
+			{
+				std::fill(Row.begin(), Row.end(), 0);
+				for( std::size_t x = 0; x < Width; ++x )
+				{
+					Row[x / 8] |= (CurJob.Frame.Row(y)[x] == 0) << (7 - x % 8);
+				}
+				std::fwrite(Row.data(), 1, Row.size(), File);
+			}
+		}
+		std::fclose(File);
+	}
+
+	const std::size_t Width;
+	const std::size_t Height;
+	const Format OutputFormat;
+	const std::size_t QueueDepth;
+
+	std::vector<std::thread> Encoders;
+
+	std::mutex QueueMutex;
+	std::condition_variable QueueNotEmpty;
+	std::condition_variable QueueNotFull;
+	std::deque<Job> Queue;
+	bool Finished = false;
+
+	std::mutex PoolMutex;
+	std::vector<qTri::Image> Pool;
+};
@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Indexed.hpp>
+#include <qTriangle/Kernels.hpp>
+
+constexpr std::uint32_t Cells = 32;
+constexpr std::int32_t CellSize = 16;
+constexpr std::size_t Extent = Cells * CellSize + 1;
+constexpr std::size_t FanVertices = 64;
+constexpr std::size_t Loops = 16;
+
+// Fills the mesh through its shared edges and checks it against filling
+// each of its triangles with the Cross-Product kernel
+static std::size_t Check(const qTri::IndexedTriangles& Mesh, const char* Name)
+{
+	const qTri::FillFunction Fill = qTri::CrossProductMethod<qTri::CrossProductWidthExp2>;
+	qTri::Image Shared(Extent, Extent);
+	qTri::Image Separate(Extent, Extent);
+	std::chrono::nanoseconds SharedTime{0};
+	std::chrono::nanoseconds SeparateTime{0};
+	for( std::size_t i = 0; i < Loops; ++i )
+	{
+		auto Start = std::chrono::steady_clock::now();
+		qTri::FillView(qTri::ImageView(Shared), Mesh);
+		SharedTime += std::chrono::steady_clock::now() - Start;
+		Start = std::chrono::steady_clock::now();
+		for( std::size_t Face = 0; Face < Mesh.Faces.size(); ++Face )
+		{
+			qTri::FillView(qTri::ImageView(Separate), Mesh.GetTriangle(Face), Fill);
+		}
+		SeparateTime += std::chrono::steady_clock::now() - Start;
+	}
+	std::size_t Mismatches = 0;
+	for( std::size_t i = 0; i < Shared.Pixels.size(); ++i )
+	{
+		Mismatches += Shared.Pixels[i] != Separate.Pixels[i];
+	}
+	const double Triangles = static_cast<double>(Mesh.Faces.size() * Loops);
+	std::printf(
+		"%s\t| %zu triangles\t| %.2f edges per triangle\t"
+		"| Shared %.1f ns\t| Separate %.1f ns per triangle\t| %zu mismatches\n",
+		Name, Mesh.Faces.size(),
+		static_cast<double>(Mesh.Edges.size()) / Mesh.Faces.size(),
+		std::chrono::duration<double, std::nano>(SharedTime).count() / Triangles,
+		std::chrono::duration<double, std::nano>(SeparateTime).count() / Triangles,
+		Mismatches
+	);
+	return Mismatches;
+}
+
+// The same jittered grid as a list and as strips joined by restarts, and a
+// convex polygon as a fan
+int main()
+{
+	std::mt19937 RandomEngine(0x1DE4ED);
+
+	// Border vertices are kept in place to keep the mesh convex
+	std::uniform_int_distribution<std::int32_t> JitterDis(-CellSize / 4, CellSize / 4);
+	std::vector<glm::i32vec2> Vertices;
+	for( std::uint32_t y = 0; y <= Cells; ++y )
+	{
+		for( std::uint32_t x = 0; x <= Cells; ++x )
+		{
+			const bool Border = x == 0 || y == 0 || x == Cells || y == Cells;
+			Vertices.emplace_back(
+				x * CellSize + (Border ? 0 : JitterDis(RandomEngine)),
+				y * CellSize + (Border ? 0 : JitterDis(RandomEngine))
+			);
+		}
+	}
+	constexpr std::uint32_t Row = Cells + 1;
+
+	std::vector<std::uint32_t> List;
+	for( std::uint32_t y = 0; y < Cells; ++y )
+	{
+		for( std::uint32_t x = 0; x < Cells; ++x )
+		{
+			const std::uint32_t TopLeft = x + y * Row;
+			List.insert(List.end(), {TopLeft, TopLeft + 1, TopLeft + Row});
+			List.insert(List.end(), {TopLeft + 1, TopLeft + Row + 1, TopLeft + Row});
+		}
+	}
+
+	// Each row alternates between its bottom and top vertices, and rows are
+	// joined by repeating the last index of one and the first of the next
+	std::vector<std::uint32_t> Strip;
+	for( std::uint32_t y = 0; y < Cells; ++y )
+	{
+		if( y != 0 )
+		{
+			Strip.push_back(Strip.back());
+			Strip.push_back(y * Row + Row);
+		}
+		for( std::uint32_t x = 0; x <= Cells; ++x )
+		{
+			Strip.push_back(x + y * Row + Row);
+			Strip.push_back(x + y * Row);
+		}
+	}
+
+	std::vector<glm::i32vec2> Polygon;
+	std::vector<std::uint32_t> Fan;
+	const glm::float32_t Radius = (Extent - 1) / 2.0f;
+	for( std::uint32_t i = 0; i < FanVertices; ++i )
+	{
+		const glm::float32_t Angle = i * glm::two_pi<glm::float32_t>() / FanVertices;
+		Polygon.emplace_back(
+			static_cast<std::int32_t>(Radius + Radius * glm::cos(Angle)),
+			static_cast<std::int32_t>(Radius + Radius * glm::sin(Angle))
+		);
+		Fan.push_back(i);
+	}
+
+	std::size_t Failures = 0;
+	Failures += Check(
+		qTri::IndexedTriangles(Vertices, List, qTri::Topology::List), "List"
+	);
+	Failures += Check(
+		qTri::IndexedTriangles(Vertices, Strip, qTri::Topology::Strip), "Strip"
+	);
+	Failures += Check(
+		qTri::IndexedTriangles(Polygon, Fan, qTri::Topology::Fan), "Fan"
+	);
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,366 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
+
+#include "Triangles.hpp"
+
+// Point counts around the block sizes of the eight and sixteen point
+// kernels, so that every variant ends in a partial block at least once
+constexpr std::size_t Counts[] = {
+	0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 1'000, 4'099
+};
+constexpr std::size_t MaxCount = 4'099;
+constexpr std::size_t TriangleCount = 64;
+constexpr std::int32_t Extent = 64;
+
+// Indices of the covered points of Expected
+static std::vector<std::uint32_t> CoveredIndices(const std::vector<std::uint8_t>& Expected)
+{
+	std::vector<std::uint32_t> Indices;
+	for( std::size_t i = 0; i < Expected.size(); ++i )
+	{
+		if( Expected[i] )
+		{
+			Indices.push_back(static_cast<std::uint32_t>(i));
+		}
+	}
+	return Indices;
+}
+
+// Blocks handed to CrossProductVisitBlocks must start on a block, ascend,
+// carry exactly the coverage of their points and never be empty, and every
+// covered point must be handed to CrossProductVisit once and in order
+static std::size_t CheckVisit(
+	const glm::i32vec2 Points[], std::size_t Count, const qTri::Triangle& Tri,
+	const std::vector<std::uint8_t>& Expected
+)
+{
+	std::size_t Mismatches = 0;
+	std::vector<std::uint8_t> Visited(Count);
+	std::size_t NextBlock = 0;
+	qTri::CrossProductVisitBlocks(
+		Points, Count, Tri,
+		[&](std::size_t Index, std::uint32_t Mask)
+		{
+			if(
+				Index % qTri::VisitBlockWidth != 0 || Index < NextBlock
+				|| Index >= Count || Mask == 0
+			)
+			{
+				++Mismatches;
+				return;
+			}
+			NextBlock = Index + qTri::VisitBlockWidth;
+			std::uint32_t ExpectedMask = 0;
+			for( std::size_t i = Index; i < std::min(Count, NextBlock); ++i )
+			{
+				ExpectedMask |= std::uint32_t(Expected[i]) << (i - Index);
+			}
+			Mismatches += Mask != ExpectedMask;
+			for( ; Mask; Mask &= Mask - 1 )
+			{
+				const std::size_t CurIndex = Index + qTri::LowestBit(Mask);
+				if( CurIndex < Count )
+				{
+					Visited[CurIndex] = 1;
+				}
+			}
+		}
+	);
+	// Covered blocks that were skipped
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		Mismatches += Visited[i] != Expected[i];
+	}
+
+	std::vector<std::size_t> Indices;
+	qTri::CrossProductVisit(
+		Points, Count, Tri,
+		[&Indices](std::size_t Index)
+		{
+			Indices.push_back(Index);
+		}
+	);
+	const std::vector<std::uint32_t> ExpectedIndices = CoveredIndices(Expected);
+	Mismatches += !std::equal(
+		Indices.begin(), Indices.end(),
+		ExpectedIndices.begin(), ExpectedIndices.end()
+	);
+	return Mismatches;
+}
+
+// Entries past the end of an output that a kernel must leave untouched
+constexpr std::size_t GuardCount = 32;
+constexpr std::uint32_t Guard = 0xDEADBEEF;
+
+// Compacted indices must be exactly the covered points in order, written
+// within the Count entries of Indices
+template<std::uint8_t WidthExp2>
+static std::size_t CheckCompact(
+	const glm::i32vec2 Points[], std::size_t Count, const qTri::Triangle& Tri,
+	const std::vector<std::uint8_t>& Expected
+)
+{
+	std::vector<std::uint32_t> Indices(Count + GuardCount, Guard);
+	const std::size_t Written = qTri::CrossProductCompact<WidthExp2>(
+		Points, Indices.data(), Count, Tri
+	);
+	const std::vector<std::uint32_t> ExpectedIndices = CoveredIndices(Expected);
+	std::size_t Mismatches = Written != ExpectedIndices.size() || !std::equal(
+		ExpectedIndices.begin(), ExpectedIndices.end(), Indices.begin()
+	);
+	Mismatches += std::count(Indices.begin() + Count, Indices.end(), Guard) != GuardCount;
+	return Mismatches;
+}
+
+// Counts must match the covered points, and any-hit whether there are any
+template<std::uint8_t WidthExp2>
+static std::size_t CheckQuery(
+	const glm::i32vec2 Points[], std::size_t Count, const qTri::Triangle& Tri,
+	const std::vector<std::uint8_t>& Expected
+)
+{
+	const std::size_t ExpectedCount = std::count(Expected.begin(), Expected.end(), 1);
+	return std::size_t(
+		qTri::CrossProductCount<WidthExp2>(Points, Count, Tri) != ExpectedCount
+	) + std::size_t(
+		qTri::CrossProductAny<WidthExp2>(Points, Count, Tri) != (ExpectedCount != 0)
+	);
+}
+
+// Garbage that written coverage must replace, and that must survive around it
+constexpr std::uint8_t Garbage = 0xA5;
+
+// Written coverage must replace whatever Results held, and leave the bytes
+// before and after it untouched
+// Results start both on and off a vector boundary, so that the serial head
+// ahead of the aligned stores is exercised
+template<typename WriteT>
+static std::size_t CheckWrite(
+	std::size_t Count, const std::vector<std::uint8_t>& Expected, WriteT&& Write
+)
+{
+	std::size_t Mismatches = 0;
+	for( const std::size_t Offset : {0, 5} )
+	{
+		qTri::PixelBuffer Results(Offset + Count + GuardCount, Garbage);
+		Write(Results.data() + Offset);
+		Mismatches += !std::equal(
+			Expected.begin(), Expected.end(), Results.begin() + Offset
+		);
+		Mismatches += std::count(
+			Results.begin(), Results.begin() + Offset, Garbage
+		) != std::ptrdiff_t(Offset);
+		Mismatches += std::count(
+			Results.begin() + Offset + Count, Results.end(), Garbage
+		) != std::ptrdiff_t(GuardCount);
+	}
+	return Mismatches;
+}
+
+// Coverage with 64-bit products, exact for any coordinates
+template<std::size_t N>
+static std::vector<std::uint8_t> ExactCoverage(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const qTri::ConvexPolygon<N>& Polygon
+)
+{
+	std::vector<std::uint8_t> Coverage(Count, 1);
+	for( std::size_t i = 0; i < Count; ++i )
+	{
+		for( std::size_t Edge = 0; Edge < N; ++Edge )
+		{
+			const glm::i64vec2 EdgeDir(Polygon[(Edge + 1) % N] - Polygon[Edge]);
+			const glm::i64vec2 PointDir(Points[i] - Polygon[Edge]);
+			Coverage[i] &= EdgeDir.x * PointDir.y - EdgeDir.y * PointDir.x >= 0;
+		}
+	}
+	return Coverage;
+}
+
+// Convex coverage, both ORed into Results and visited by block, must match
+// Expected at every index, whether it lands in a vector body or serial tail
+template<std::size_t N>
+static std::size_t CheckConvex(
+	const glm::i32vec2 Points[], std::size_t Count,
+	const qTri::ConvexPolygon<N>& Polygon, const std::vector<std::uint8_t>& Expected
+)
+{
+	std::vector<std::uint8_t> Results(Count);
+	qTri::ConvexMethod(Points, Results.data(), Count, Polygon);
+	std::size_t Mismatches = Results != Expected;
+
+	std::vector<std::uint8_t> Visited(Count);
+	qTri::ConvexVisitBlocks(
+		Points, Count, Polygon,
+		[&](std::size_t Index, std::uint32_t Mask)
+		{
+			for( ; Mask; Mask &= Mask - 1 )
+			{
+				Visited.at(Index + qTri::LowestBit(Mask)) = 1;
+			}
+		}
+	);
+	Mismatches += Visited != Expected;
+	return Mismatches;
+}
+
+// Checks each kernel variant against the coverage of CrossProductMethod<0>
+// for random points and triangles over every count
+int main()
+{
+	std::mt19937 RandomEngine(0x4E27E1);
+	std::uniform_int_distribution<std::int32_t> CoordDis(0, Extent);
+	std::vector<glm::i32vec2> Points(MaxCount);
+	for( glm::i32vec2& CurPoint : Points )
+	{
+		CurPoint = glm::i32vec2(CoordDis(RandomEngine), CoordDis(RandomEngine));
+	}
+
+	// Random triangles around the points, and one past them that covers
+	// nothing
+	std::vector<qTri::Triangle> Triangles;
+	for( std::size_t i = 0; i < TriangleCount; ++i )
+	{
+		Triangles.push_back(
+			RandomTriangle(RandomEngine, glm::i32vec2(-8), glm::i32vec2(Extent + 8))
+		);
+	}
+	Triangles.push_back(
+		qTri::Triangle{{{Extent + 1, 0}, {Extent + 9, 0}, {Extent + 1, 8}}}
+	);
+
+	std::size_t VisitFailures = 0;
+	std::size_t CompactFailures = 0;
+	std::size_t QueryFailures = 0;
+	std::size_t WriteFailures = 0;
+	for( const qTri::Triangle& CurTriangle : Triangles )
+	{
+		for( const std::size_t Count : Counts )
+		{
+			std::vector<std::uint8_t> Expected(Count);
+			qTri::CrossProductMethod<0>(
+				Points.data(), Expected.data(), Count, CurTriangle
+			);
+			VisitFailures += CheckVisit(Points.data(), Count, CurTriangle, Expected);
+			CompactFailures += CheckCompact<0>(Points.data(), Count, CurTriangle, Expected);
+			CompactFailures += CheckCompact<3>(Points.data(), Count, CurTriangle, Expected);
+			CompactFailures += CheckCompact<4>(Points.data(), Count, CurTriangle, Expected);
+			QueryFailures += CheckQuery<0>(Points.data(), Count, CurTriangle, Expected);
+			QueryFailures += CheckQuery<3>(Points.data(), Count, CurTriangle, Expected);
+			QueryFailures += CheckQuery<4>(Points.data(), Count, CurTriangle, Expected);
+			for( const bool NonTemporal : {false, true} )
+			{
+				WriteFailures += CheckWrite(
+					Count, Expected,
+					[&](std::uint8_t Results[])
+					{
+						qTri::CrossProductWrite<0>(
+							Points.data(), Results, Count, CurTriangle, NonTemporal
+						);
+					}
+				);
+				WriteFailures += CheckWrite(
+					Count, Expected,
+					[&](std::uint8_t Results[])
+					{
+						qTri::CrossProductWrite<3>(
+							Points.data(), Results, Count, CurTriangle, NonTemporal
+						);
+					}
+				);
+			}
+			WriteFailures += CheckWrite(
+				Count, Expected,
+				[&](std::uint8_t Results[])
+				{
+					qTri::CrossProductOverwrite<qTri::CrossProductWriteWidthExp2>(
+						Points.data(), Results, Count, CurTriangle
+					);
+				}
+			);
+		}
+	}
+
+	// Triangles and rectangles spanning all of [-ConvexLimit, ConvexLimit] are
+	// exact. Past it the products wrap, but every point must still get the
+	// same answer as the serial edge test.
+	std::size_t ConvexFailures = 0;
+	for( const std::int32_t Limit : {qTri::ConvexLimit, std::int32_t(INT16_MAX)} )
+	{
+		std::uniform_int_distribution<std::int32_t> LargeDis(-Limit, Limit);
+		std::vector<glm::i32vec2> LargePoints(MaxCount);
+		for( glm::i32vec2& CurPoint : LargePoints )
+		{
+			CurPoint = glm::i32vec2(LargeDis(RandomEngine), LargeDis(RandomEngine));
+		}
+		const auto Reference = [&](std::size_t Count, const auto& Polygon)
+		{
+			if( Limit <= qTri::ConvexLimit )
+			{
+				return ExactCoverage(LargePoints.data(), Count, Polygon);
+			}
+			const qTri::ConvexEdges1<std::tuple_size<std::decay_t<decltype(Polygon)>>::value>
+				SerialEdges(Polygon);
+			std::vector<std::uint8_t> Coverage(Count);
+			for( std::size_t i = 0; i < Count; ++i )
+			{
+				Coverage[i] = SerialEdges.Covered(LargePoints[i]);
+			}
+			return Coverage;
+		};
+		for( std::size_t i = 0; i < TriangleCount; ++i )
+		{
+			const qTri::Triangle CurTriangle = RandomTriangle(
+				RandomEngine, glm::i32vec2(-Limit), glm::i32vec2(Limit)
+			);
+			const glm::i32vec2 A(LargeDis(RandomEngine), LargeDis(RandomEngine));
+			const glm::i32vec2 B(LargeDis(RandomEngine), LargeDis(RandomEngine));
+			const glm::i32vec2 Min = glm::min(A, B);
+			const glm::i32vec2 Max = glm::max(A, B);
+			const qTri::ConvexPolygon<4> CurRectangle = {
+				{Min, glm::i32vec2(Max.x, Min.y), Max, glm::i32vec2(Min.x, Max.y)}
+			};
+			for( const std::size_t Count : Counts )
+			{
+				ConvexFailures += CheckConvex(
+					LargePoints.data(), Count, CurTriangle, Reference(Count, CurTriangle)
+				);
+				ConvexFailures += CheckConvex(
+					LargePoints.data(), Count, CurRectangle, Reference(Count, CurRectangle)
+				);
+			}
+		}
+	}
+
+	std::printf("Visit\t| %zu mismatches\n", VisitFailures);
+	std::printf(
+		"Compact\t| %s\t| %zu mismatches\n",
+		qTri::CrossProductCompactISA, CompactFailures
+	);
+	std::printf(
+		"Query\t| %s\t| %zu mismatches\n",
+		qTri::CrossProductQueryISA, QueryFailures
+	);
+	std::printf(
+		"Write\t| %s\t| %zu mismatches\n",
+		qTri::CrossProductWriteISA, WriteFailures
+	);
+	std::printf("Convex\t| %zu mismatches\n", ConvexFailures);
+
+	const std::size_t Failures =
+		VisitFailures + CompactFailures + QueryFailures + WriteFailures
+		+ ConvexFailures;
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <memory_resource>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+
+// Sizes either side of a single byte, a page and a huge page
+constexpr std::size_t HugePageSize = qTri::HugePageResource::HugePageSize;
+constexpr std::size_t Sizes[] = {
+	1, 63, 64, 65, 4'095, 4'096, 4'097,
+	HugePageSize - 1, HugePageSize, HugePageSize + 1, 3 * HugePageSize + 5
+};
+
+static bool Aligned(const void* Pointer, std::size_t Alignment)
+{
+	return reinterpret_cast<std::uintptr_t>(Pointer) % Alignment == 0;
+}
+
+// Buffers must be aligned to BufferAlignment whatever resource they come from
+// A monotonic buffer hands out memory packed as tightly as asked for, so it
+// only aligns when the allocator asks it to
+static std::size_t CheckAllocator()
+{
+	std::size_t Mismatches = 0;
+	std::pmr::monotonic_buffer_resource Arena;
+	for( const std::size_t Size : Sizes )
+	{
+		const qTri::PixelBuffer Pixels(Size);
+		const qTri::PointBuffer Points(Size);
+		const qTri::PixelBuffer ArenaPixels(
+			Size, qTri::AlignedAllocator<std::uint8_t>(&Arena)
+		);
+		Mismatches += !Aligned(Pixels.data(), qTri::BufferAlignment);
+		Mismatches += !Aligned(Points.data(), qTri::BufferAlignment);
+		Mismatches += !Aligned(ArenaPixels.data(), qTri::BufferAlignment);
+	}
+	return Mismatches;
+}
+
+// Strides round up to whole elements and then to RowAlignment, and every row
+// of an image starts on its alignment
+template<typename PixelT>
+static std::size_t CheckStride(
+	std::size_t Width, std::size_t RowAlignment, std::size_t ExpectedStride,
+	std::pmr::memory_resource* Resource = std::pmr::get_default_resource()
+)
+{
+	constexpr std::size_t Height = 5;
+	qTri::BasicImage<PixelT> CurImage(Width, Height, RowAlignment, Resource);
+	std::size_t Mismatches = CurImage.Stride != ExpectedStride;
+	Mismatches += CurImage.Pixels.size() != ExpectedStride * Height;
+	Mismatches += !Aligned(CurImage.Pixels.data(), qTri::BufferAlignment);
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		Mismatches += !Aligned(CurImage.Row(y), RowAlignment * sizeof(PixelT));
+	}
+	return Mismatches;
+}
+
+// Allocations through HugePages() must be aligned, hold what is written to
+// them and return to where they came from
+// Those of a huge page or more are mapped on their own, whole huge pages at a
+// time
+static std::size_t CheckHugePages()
+{
+	std::size_t Mismatches = 0;
+	qTri::HugePageResource* Resource = qTri::HugePages();
+	Mismatches += !Resource->is_equal(*qTri::HugePages());
+	Mismatches += Resource->is_equal(*std::pmr::get_default_resource());
+	for( const std::size_t Size : Sizes )
+	{
+		std::uint8_t* Bytes = static_cast<std::uint8_t*>(
+			Resource->allocate(Size, qTri::BufferAlignment)
+		);
+		Mismatches += !Aligned(Bytes, qTri::BufferAlignment);
+#if defined(__linux__)
+		if( Size >= HugePageSize )
+		{
+			Mismatches += !Aligned(Bytes, HugePageSize);
+		}
+#endif
+		for( std::size_t i = 0; i < Size; ++i )
+		{
+			Bytes[i] = static_cast<std::uint8_t>(i * 7);
+		}
+		for( std::size_t i = 0; i < Size; ++i )
+		{
+			Mismatches += Bytes[i] != static_cast<std::uint8_t>(i * 7);
+		}
+		Resource->deallocate(Bytes, Size, qTri::BufferAlignment);
+	}
+
+	// Frames large enough to be mapped, and ones small enough not to be
+	qTri::Image Large(2'048, 2'048, 64, Resource);
+	std::fill(Large.Pixels.begin(), Large.Pixels.end(), 1);
+	Mismatches += std::count(Large.Pixels.begin(), Large.Pixels.end(), 1)
+		!= std::ptrdiff_t(Large.Pixels.size());
+	qTri::Image Small(64, 64, 64, Resource);
+	std::fill(Small.Pixels.begin(), Small.Pixels.end(), 1);
+	Mismatches += std::count(Small.Pixels.begin(), Small.Pixels.end(), 1)
+		!= std::ptrdiff_t(Small.Pixels.size());
+	return Mismatches;
+}
+
+// Checks buffer alignment, image strides and huge page allocations
+int main()
+{
+	const std::size_t AllocatorFailures = CheckAllocator();
+	std::printf("Allocator\t| %zu mismatches\n", AllocatorFailures);
+
+	std::size_t StrideFailures = 0;
+	StrideFailures += CheckStride<std::uint8_t>(509, 1, 509);
+	StrideFailures += CheckStride<std::uint8_t>(509, 64, 512);
+	StrideFailures += CheckStride<std::uint8_t>(512, 64, 512);
+	StrideFailures += CheckStride<std::uint8_t>(513, 64, 576);
+	StrideFailures += CheckStride<std::uint32_t>(509, 16, 512);
+	StrideFailures += CheckStride<qTri::Bit8>(509, 1, 64);
+	StrideFailures += CheckStride<qTri::Bit8>(509, 64, 64);
+	StrideFailures += CheckStride<qTri::Bit8>(513, 64, 128);
+	StrideFailures += CheckStride<std::uint8_t>(4'099, 64, 4'160, qTri::HugePages());
+	std::printf("Stride\t| %zu mismatches\n", StrideFailures);
+
+	const std::size_t HugePageFailures = CheckHugePages();
+	std::printf("Huge pages\t| %zu mismatches\n", HugePageFailures);
+
+	const std::size_t Failures = AllocatorFailures + StrideFailures + HugePageFailures;
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
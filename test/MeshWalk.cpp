@@ -0,0 +1,170 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <algorithm>
+#include <random>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Mesh.hpp>
+
+#include "Bench.hpp"
+
+constexpr std::size_t Cells = 32;
+constexpr std::int32_t CellSize = 16;
+constexpr std::size_t PointCount = 1 << 15;
+
+// Checks that every point landed in a face that actually covers it
+static std::size_t CountMisses(
+	const qTri::Mesh& Surface,
+	const std::vector<glm::i32vec2>& Points,
+	const std::vector<std::uint32_t>& Faces
+)
+{
+	std::size_t Misses = 0;
+	for( std::size_t i = 0; i < Points.size(); ++i )
+	{
+		if( Faces[i] == qTri::Mesh::NoFace )
+		{
+			++Misses;
+			continue;
+		}
+		const qTri::Triangle Tri = Surface.GetTriangle(Faces[i]);
+		Misses += !(
+			qTri::Det( Tri[1] - Tri[0], Points[i] - Tri[0] ) >= 0 &&
+			qTri::Det( Tri[2] - Tri[1], Points[i] - Tri[1] ) >= 0 &&
+			qTri::Det( Tri[0] - Tri[2], Points[i] - Tri[2] ) >= 0
+		);
+	}
+	return Misses;
+}
+
+int main()
+{
+	std::mt19937 RandomEngine(0x7154'0C0D);
+
+	// Jittered grid, border vertices are kept in place to keep the mesh convex
+	std::uniform_int_distribution<std::int32_t> JitterDis(-CellSize / 4, CellSize / 4);
+	std::vector<glm::i32vec2> Vertices;
+	for( std::size_t y = 0; y <= Cells; ++y )
+	{
+		for( std::size_t x = 0; x <= Cells; ++x )
+		{
+			const bool Border = x == 0 || y == 0 || x == Cells || y == Cells;
+			Vertices.emplace_back(
+				x * CellSize + (Border ? 0 : JitterDis(RandomEngine)),
+				y * CellSize + (Border ? 0 : JitterDis(RandomEngine))
+			);
+		}
+	}
+	std::vector<std::array<std::uint32_t,3>> Faces;
+	for( std::uint32_t y = 0; y < Cells; ++y )
+	{
+		for( std::uint32_t x = 0; x < Cells; ++x )
+		{
+			const std::uint32_t Row = Cells + 1;
+			const std::uint32_t TopLeft = x + y * Row;
+			Faces.push_back({{TopLeft, TopLeft + 1, TopLeft + Row}});
+			Faces.push_back({{TopLeft + 1, TopLeft + Row + 1, TopLeft + Row}});
+		}
+	}
+	const qTri::Mesh Surface(std::move(Vertices), std::move(Faces));
+
+	// Random points inside the mesh
+	std::uniform_int_distribution<std::int32_t> CoordDis(0, Cells * CellSize);
+	std::vector<glm::i32vec2> Shuffled(PointCount);
+	for( glm::i32vec2& CurPoint : Shuffled )
+	{
+		CurPoint.x = CoordDis(RandomEngine);
+		CurPoint.y = CoordDis(RandomEngine);
+	}
+	std::vector<glm::i32vec2> Sorted(Shuffled);
+	std::sort(
+		Sorted.begin(), Sorted.end(),
+		[](const glm::i32vec2& A, const glm::i32vec2& B) -> bool
+		{
+			return A.y != B.y ? A.y < B.y : A.x < B.x;
+		}
+	);
+
+	std::printf(
+		"%zu Points x %zu Faces\n",
+		PointCount,
+		Surface.Faces.size()
+	);
+	std::printf(
+		"Algorithm | Sorted per point(ns) | Shuffled per point(ns)\n"
+	);
+
+	bool Failed = false;
+	std::vector<std::uint32_t> Located(PointCount);
+	for( const auto& LocateAlgorithm : qTri::LocateAlgorithms )
+	{
+		std::printf(
+			"%s\t",
+			LocateAlgorithm.second
+		);
+		for( const std::vector<glm::i32vec2>* Points : {&Sorted, &Shuffled} )
+		{
+			const std::size_t ExecTime = Bench<>::Duration(
+				LocateAlgorithm.first,
+				Surface,
+				Points->data(),
+				Located.data(),
+				Points->size()
+			).count();
+			const std::size_t Misses = CountMisses(Surface, *Points, Located);
+			Failed |= Misses != 0;
+			std::printf(
+				"| %.2f ns (%zu misses)\t",
+				ExecTime / static_cast<double>(PointCount),
+				Misses
+			);
+		}
+		std::printf("\n");
+	}
+
+	// Brute force, every face is filled against every point
+	// Kernels with half-open edges may miss points along the border of the mesh
+	std::vector<std::uint8_t> Results(PointCount);
+	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+	{
+		std::printf(
+			"%s\t",
+			FillAlgorithm.Name
+		);
+		for( const std::vector<glm::i32vec2>* Points : {&Sorted, &Shuffled} )
+		{
+			std::fill(Located.begin(), Located.end(), qTri::Mesh::NoFace);
+			const std::size_t ExecTime = Bench<>::Duration(
+				[&]()
+				{
+					for( std::uint32_t Face = 0; Face < Surface.Faces.size(); ++Face )
+					{
+						std::fill(Results.begin(), Results.end(), 0);
+						FillAlgorithm.Fill(
+							Points->data(),
+							Results.data(),
+							Points->size(),
+							Surface.GetTriangle(Face)
+						);
+						for( std::size_t i = 0; i < Points->size(); ++i )
+						{
+							Located[i] = Results[i] ? Face : Located[i];
+						}
+					}
+				}
+			).count();
+			const std::size_t Misses = CountMisses(Surface, *Points, Located);
+			std::printf(
+				"| %.2f ns (%zu misses)\t",
+				ExecTime / static_cast<double>(PointCount),
+				Misses
+			);
+		}
+		std::printf("\n");
+	}
+	return Failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
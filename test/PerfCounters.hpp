@@ -0,0 +1,151 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware performance counters of the calling thread through perf_event_open
+// Each counter is opened on its own so that a missing event, or a container
+// that denies perf_event_open entirely, only disables the affected counters
+class PerfCounters
+{
+public:
+	enum Counter : std::size_t
+	{
+		Cycles,
+		Instructions,
+		L1DMisses,
+		LLCMisses,
+		BranchMisses,
+		CounterCount
+	};
+
+	static const char* Name(Counter Index)
+	{
+		static const char* const Names[CounterCount] = {
+			"Cycles",
+			"Instructions",
+			"L1D misses",
+			"LLC misses",
+			"Branch misses",
+		};
+		return Names[Index];
+	}
+
+	PerfCounters()
+	{
+		Descriptors.fill(-1);
+#if defined(__linux__)
+		constexpr std::uint64_t CacheReadMiss
+			= (PERF_COUNT_HW_CACHE_OP_READ << 8)
+			| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		const std::pair<std::uint32_t, std::uint64_t> Events[CounterCount] = {
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+			{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | CacheReadMiss},
+			{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL  | CacheReadMiss},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+		};
+		for( std::size_t i = 0; i < CounterCount; ++i )
+		{
+			perf_event_attr Attributes{};
+			Attributes.size = sizeof(perf_event_attr);
+			Attributes.type = Events[i].first;
+			Attributes.config = Events[i].second;
+			Attributes.disabled = 1;
+			Attributes.exclude_kernel = 1;
+			Attributes.exclude_hv = 1;
+			// Counters are scaled when the kernel has to multiplex them
+			Attributes.read_format
+				= PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			Descriptors[i] = static_cast<int>(
+				syscall(SYS_perf_event_open, &Attributes, 0, -1, -1, 0)
+			);
+		}
+#endif
+	}
+
+	~PerfCounters()
+	{
+#if defined(__linux__)
+		for( const int Descriptor : Descriptors )
+		{
+			if( Descriptor >= 0 )
+			{
+				close(Descriptor);
+			}
+		}
+#endif
+	}
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	bool Available(Counter Index) const
+	{
+		return Descriptors[Index] >= 0;
+	}
+
+	bool AnyAvailable() const
+	{
+		for( std::size_t i = 0; i < CounterCount; ++i )
+		{
+			if( Available(Counter(i)) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void Start()
+	{
+#if defined(__linux__)
+		for( const int Descriptor : Descriptors )
+		{
+			if( Descriptor >= 0 )
+			{
+				ioctl(Descriptor, PERF_EVENT_IOC_RESET, 0);
+				ioctl(Descriptor, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+#endif
+	}
+
+	// Returns the counts since Start, unavailable counters read as zero
+	std::array<double, CounterCount> Stop()
+	{
+		std::array<double, CounterCount> Counts{};
+#if defined(__linux__)
+		for( std::size_t i = 0; i < CounterCount; ++i )
+		{
+			if( Descriptors[i] < 0 )
+			{
+				continue;
+			}
+			ioctl(Descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+			// Value, time enabled, time running
+			std::uint64_t Values[3] = {};
+			if(
+				read(Descriptors[i], Values, sizeof(Values)) == sizeof(Values)
+				&& Values[2] != 0
+			)
+			{
+				Counts[i] = Values[0] * (
+					static_cast<double>(Values[1]) / Values[2]
+				);
+			}
+		}
+#endif
+		return Counts;
+	}
+
+private:
+	std::array<int, CounterCount> Descriptors;
+};
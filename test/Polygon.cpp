@@ -0,0 +1,231 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Polygon.hpp>
+#include <qTriangle/Kernels.hpp>
+
+constexpr std::size_t Width = 300;
+constexpr std::size_t Height = 300;
+constexpr std::size_t StarCount = 64;
+
+// Twice the area enclosed by a contour
+static std::int64_t Area(const qTri::Contour& Ring)
+{
+	std::int64_t Sum = 0;
+	for( std::size_t i = 0; i < Ring.size(); ++i )
+	{
+		const glm::i32vec2& A = Ring[i];
+		const glm::i32vec2& B = Ring[(i + 1) % Ring.size()];
+		Sum += std::int64_t(A.x) * B.y - std::int64_t(A.y) * B.x;
+	}
+	return Sum < 0 ? -Sum : Sum;
+}
+
+// Whether Point is on any edge of the contours, where coverage is left to
+// the edge rules of the kernel
+static bool OnEdge(const std::vector<qTri::Contour>& Rings, const glm::i32vec2& Point)
+{
+	for( const qTri::Contour& Ring : Rings )
+	{
+		for( std::size_t i = 0; i < Ring.size(); ++i )
+		{
+			const glm::i32vec2& A = Ring[i];
+			const glm::i32vec2& B = Ring[(i + 1) % Ring.size()];
+			if(
+				qTri::Det(B - A, Point - A) == 0
+				&& Point.x >= glm::min(A.x, B.x) && Point.x <= glm::max(A.x, B.x)
+				&& Point.y >= glm::min(A.y, B.y) && Point.y <= glm::max(A.y, B.y)
+			)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+// Even-odd rule across every contour
+static bool Inside(const std::vector<qTri::Contour>& Rings, const glm::i32vec2& Point)
+{
+	bool Result = false;
+	for( const qTri::Contour& Ring : Rings )
+	{
+		for( std::size_t i = 0; i < Ring.size(); ++i )
+		{
+			const glm::i32vec2& A = Ring[i];
+			const glm::i32vec2& B = Ring[(i + 1) % Ring.size()];
+			if( (A.y > Point.y) != (B.y > Point.y) )
+			{
+				const double X = A.x + double(Point.y - A.y) * (B.x - A.x) / (B.y - A.y);
+				Result ^= Point.x < X;
+			}
+		}
+	}
+	return Result;
+}
+
+// Triangulates the polygon and checks that the triangles exactly tile its
+// area and cover every pixel inside of it and none outside of it
+static std::size_t Check(
+	const qTri::Contour& Outer, const std::vector<qTri::Contour>& Holes,
+	const char* Name, bool Print
+)
+{
+	const auto Start = std::chrono::steady_clock::now();
+	const std::vector<qTri::Triangle> Triangles = qTri::Triangulate(Outer, Holes);
+	const auto Duration = std::chrono::steady_clock::now() - Start;
+
+	std::size_t Failures = 0;
+	std::int64_t Expected = Area(Outer);
+	std::size_t Vertices = Outer.size();
+	for( const qTri::Contour& CurHole : Holes )
+	{
+		Expected -= Area(CurHole);
+		Vertices += CurHole.size();
+	}
+	std::int64_t Tiled = 0;
+	for( const qTri::Triangle& CurTriangle : Triangles )
+	{
+		const std::int64_t CurArea = qTri::Det(
+			CurTriangle[1] - CurTriangle[0], CurTriangle[2] - CurTriangle[0]
+		);
+		// Every triangle must be wound for the kernels
+		Failures += CurArea <= 0;
+		Tiled += CurArea;
+	}
+	Failures += Tiled != Expected;
+	Failures += Triangles.size() > Vertices + 2 * Holes.size() - 2;
+
+	qTri::Image Coverage(Width, Height);
+	for( const qTri::Triangle& CurTriangle : Triangles )
+	{
+		qTri::FillView(
+			qTri::ImageView(Coverage), CurTriangle,
+			qTri::CrossProductMethod<qTri::CrossProductWidthExp2>
+		);
+	}
+	std::vector<qTri::Contour> Rings(Holes);
+	Rings.push_back(Outer);
+	std::size_t Mismatches = 0;
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		for( std::size_t x = 0; x < Width; ++x )
+		{
+			const glm::i32vec2 Point(x, y);
+			if( !OnEdge(Rings, Point) )
+			{
+				Mismatches += Coverage.Row(y)[x] != Inside(Rings, Point);
+			}
+		}
+	}
+	Failures += Mismatches;
+
+	if( Print || Failures )
+	{
+		std::printf(
+			"%s\t| %zu vertices, %zu holes\t| %zu triangles\t| %.1f us\t"
+			"| Area %lld of %lld\t| %zu mismatches\n",
+			Name, Vertices, Holes.size(), Triangles.size(),
+			std::chrono::duration<double, std::micro>(Duration).count(),
+			static_cast<long long>(Tiled), static_cast<long long>(Expected),
+			Mismatches
+		);
+	}
+	return Failures;
+}
+
+// The glyph of FillShape, a square with a grid of square holes, a comb of
+// reflex vertices and random star-shaped polygons with holes
+int main()
+{
+	std::size_t Failures = 0;
+
+	// "a", its counter is a hole
+	const qTri::Contour Glyph = {
+		{238,233}, {200,257}, {159,264}, {105,247}, {86,203}, {93,174},
+		{112,153}, {138,141}, {171,136}, {236,123}, {236,114}, {226,82},
+		{184,70}, {146,79}, {128,111}, {92,106}, {108,69}, {140,48},
+		{189,40}, {234,47}, {259,63}, {270,87}, {272,121}, {272,169},
+		{274,233}, {283,259}, {246,259}
+	};
+	const qTri::Contour Counter = {
+		{235,152}, {176,165}, {144,173}, {129,184}, {124,202}, {135,226},
+		{168,235}, {206,226}, {230,201}, {236,165}
+	};
+	Failures += Check(Glyph, {Counter}, "Glyph", true);
+
+	const qTri::Contour Square = {{20, 20}, {280, 20}, {280, 280}, {20, 280}};
+	std::vector<qTri::Contour> Windows;
+	for( std::int32_t y = 0; y < 3; ++y )
+	{
+		for( std::int32_t x = 0; x < 3; ++x )
+		{
+			const glm::i32vec2 Corner(50 + x * 80, 50 + y * 80);
+			Windows.push_back(
+				{
+					Corner, Corner + glm::i32vec2(0, 40),
+					Corner + glm::i32vec2(40, 40), Corner + glm::i32vec2(40, 0)
+				}
+			);
+		}
+	}
+	Failures += Check(Square, Windows, "Windows", true);
+
+	// Teeth hanging from a spine, every gap between them is reflex
+	qTri::Contour Comb = {{10, 10}, {290, 10}, {290, 290}};
+	for( std::int32_t x = 290 - 20; x >= 10; x -= 20 )
+	{
+		Comb.push_back({x + 10, 40});
+		Comb.push_back({x, 290});
+	}
+	Failures += Check(Comb, {}, "Comb", true);
+
+	std::mt19937 RandomEngine(0x9017609);
+	std::uniform_int_distribution<std::int32_t> RadiusDis(90, 140);
+	std::uniform_int_distribution<std::int32_t> VertexDis(3, 96);
+	std::uniform_int_distribution<std::int32_t> HoleDis(0, 4);
+	const glm::i32vec2 Center(Width / 2, Height / 2);
+	for( std::size_t i = 0; i < StarCount; ++i )
+	{
+		qTri::Contour Star;
+		const std::int32_t Vertices = VertexDis(RandomEngine);
+		for( std::int32_t j = 0; j < Vertices; ++j )
+		{
+			const glm::float32_t Angle = j * glm::two_pi<glm::float32_t>() / Vertices;
+			const glm::float32_t Radius = static_cast<glm::float32_t>(RadiusDis(RandomEngine));
+			Star.push_back(
+				Center + glm::i32vec2(
+					static_cast<std::int32_t>(Radius * glm::cos(Angle)),
+					static_cast<std::int32_t>(Radius * glm::sin(Angle))
+				)
+			);
+		}
+		// Holes within the smallest radius, clear of each other
+		std::vector<qTri::Contour> Holes;
+		const std::int32_t HoleCount = Vertices >= 8 ? HoleDis(RandomEngine) : 0;
+		for( std::int32_t j = 0; j < HoleCount; ++j )
+		{
+			const glm::i32vec2 Corner = Center + glm::i32vec2(
+				(j % 2) * 30 - 25, (j / 2) * 30 - 25
+			);
+			Holes.push_back(
+				{
+					Corner, Corner + glm::i32vec2(20, 3),
+					Corner + glm::i32vec2(17, 20), Corner + glm::i32vec2(2, 15)
+				}
+			);
+		}
+		Failures += Check(Star, Holes, "Star", false);
+	}
+	std::printf("%zu failures\n", Failures);
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
+#include <qTriangle/Scene.hpp>
+
+#include "Triangles.hpp"
+
+constexpr std::size_t Width = 256;
+constexpr std::size_t Height = 256;
+constexpr std::size_t TriangleCount = 2'000;
+constexpr std::size_t Frames = 100;
+// Triangles moved each frame
+constexpr std::size_t Moves = 8;
+
+// Small triangle with vertices within 16 pixels of each other, around and
+// partially outside of the frame
+static qTri::Triangle RandomTriangle(std::mt19937& RandomEngine)
+{
+	std::uniform_int_distribution<std::int32_t> WidthDis(-8, Width + 8);
+	std::uniform_int_distribution<std::int32_t> HeightDis(-8, Height + 8);
+	const glm::i32vec2 Center(WidthDis(RandomEngine), HeightDis(RandomEngine));
+	return RandomTriangle(
+		RandomEngine, Center - glm::i32vec2(16), Center + glm::i32vec2(16)
+	);
+}
+
+// Animates a few triangles of a large scene each frame and checks that
+// re-rasterizing the dirty regions matches rasterizing the whole scene
+int main()
+{
+	std::mt19937 RandomEngine(0x5CE4E);
+	const qTri::FillFunction Fill = qTri::CrossProductMethod<qTri::CrossProductWidthExp2>;
+
+	qTri::Scene CurScene(Width, Height, Fill);
+	for( std::size_t i = 0; i < TriangleCount; ++i )
+	{
+		CurScene.Add(RandomTriangle(RandomEngine));
+	}
+	CurScene.Render();
+
+	std::uniform_int_distribution<std::uint32_t> IDDis(0, TriangleCount - 1);
+	std::uniform_int_distribution<std::int32_t> StepDis(-3, 3);
+	std::size_t Mismatches = 0;
+	std::size_t Pixels = 0;
+	std::chrono::nanoseconds Incremental{0};
+	std::chrono::nanoseconds Full{0};
+	for( std::size_t Frame = 0; Frame < Frames; ++Frame )
+	{
+		for( std::size_t i = 0; i < Moves; ++i )
+		{
+			const std::uint32_t ID = IDDis(RandomEngine);
+			qTri::Triangle CurTriangle = CurScene.GetTriangle(ID);
+			const glm::i32vec2 Step(StepDis(RandomEngine), StepDis(RandomEngine));
+			for( glm::i32vec2& CurVert : CurTriangle )
+			{
+				CurVert += Step;
+			}
+			CurScene.Update(ID, CurTriangle);
+		}
+		// Every few frames a triangle jumps across the frame
+		if( Frame % 10 == 0 )
+		{
+			CurScene.Update(IDDis(RandomEngine), RandomTriangle(RandomEngine));
+		}
+		auto Start = std::chrono::steady_clock::now();
+		Pixels += CurScene.Render();
+		Incremental += std::chrono::steady_clock::now() - Start;
+
+		qTri::Image Expected(Width, Height);
+		Start = std::chrono::steady_clock::now();
+		for( std::size_t i = 0; i < CurScene.TriangleCount(); ++i )
+		{
+			qTri::FillView(
+				qTri::ImageView(Expected),
+				CurScene.GetTriangle(static_cast<std::uint32_t>(i)), Fill
+			);
+		}
+		Full += std::chrono::steady_clock::now() - Start;
+		for( std::size_t i = 0; i < Expected.Pixels.size(); ++i )
+		{
+			Mismatches += Expected.Pixels[i] != CurScene.Frame().Pixels[i];
+		}
+	}
+
+	std::printf(
+		"%zu x %zu, %zu triangles, %zu moved per frame\n"
+		"Full redraw\t| %.1f us per frame\n"
+		"Dirty regions\t| %.1f us per frame\t| %.1f%% of pixels\n"
+		"%zu mismatches\n",
+		Width, Height, TriangleCount, Moves,
+		std::chrono::duration<double, std::micro>(Full).count() / Frames,
+		std::chrono::duration<double, std::micro>(Incremental).count() / Frames,
+		100.0 * Pixels / (Frames * Width * Height),
+		Mismatches
+	);
+	return Mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <random>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Stream.hpp>
+
+constexpr std::size_t Width = 4096;
+constexpr std::size_t Height = 4096;
+constexpr std::size_t PointCount = 1 << 22;
+
+// Streams a point file through every algorithm
+// Stream [InputPath] [OutputPath]
+// Without arguments a file of random points is generated and each output is
+// checked against classifying the same points in memory
+int main(int argc, char* argv[])
+{
+	const char* InputPath = argc > 1 ? argv[1] : "StreamPoints.bin";
+	const char* OutputPath = argc > 2 ? argv[2] : "StreamResults.bin";
+
+	std::mt19937 RandomEngine(0x5EED);
+	std::uniform_int_distribution<std::int32_t> WidthDis(0, Width);
+	std::uniform_int_distribution<std::int32_t> HeightDis(0, Height);
+
+	const qTri::Triangle Tris[] = {
+		{{ {0, 0}, {Width, 0}, {0, Height} }},
+		{{ {Width / 2, Height / 4}, {Width, Height}, {Width / 4, Height} }},
+	};
+
+	std::vector<glm::i32vec2> Points;
+	if( argc <= 1 )
+	{
+		Points.resize(PointCount);
+		for( glm::i32vec2& CurPoint : Points )
+		{
+			CurPoint.x = WidthDis(RandomEngine);
+			CurPoint.y = HeightDis(RandomEngine);
+		}
+		std::FILE* InputFile = std::fopen(InputPath, "wb");
+		if( InputFile == nullptr )
+		{
+			std::perror(InputPath);
+			return EXIT_FAILURE;
+		}
+		std::fwrite(Points.data(), sizeof(glm::i32vec2), Points.size(), InputFile);
+		std::fclose(InputFile);
+	}
+
+	std::printf(
+		"Algorithm | Points/s | MiB/s\n"
+	);
+	bool Failed = false;
+	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+	{
+		qTri::StreamStats Stats;
+		if(
+			!qTri::ClassifyFile(
+				InputPath, OutputPath,
+				Tris, std::extent<decltype(Tris)>::value,
+				FillAlgorithm.Fill,
+				&Stats
+			)
+		)
+		{
+			std::perror("ClassifyFile");
+			return EXIT_FAILURE;
+		}
+		std::printf(
+			"%s\t| %.3e\t| %.1f\n",
+			FillAlgorithm.Name,
+			Stats.PointsPerSecond(),
+			Stats.BytesPerSecond() / (1024.0 * 1024.0)
+		);
+
+		if( Points.empty() )
+		{
+			continue;
+		}
+		std::vector<std::uint8_t> Expected(Points.size());
+		for( const qTri::Triangle& CurTriangle : Tris )
+		{
+			FillAlgorithm.Fill(
+				Points.data(), Expected.data(), Points.size(), CurTriangle
+			);
+		}
+		std::vector<std::uint8_t> Results(Points.size());
+		std::FILE* OutputFile = std::fopen(OutputPath, "rb");
+		if(
+			OutputFile == nullptr ||
+			std::fread(Results.data(), 1, Results.size(), OutputFile) != Results.size()
+		)
+		{
+			std::perror(OutputPath);
+			return EXIT_FAILURE;
+		}
+		std::fclose(OutputFile);
+		if( Results != Expected )
+		{
+			std::printf("%s: streamed results differ\n", FillAlgorithm.Name);
+			Failed = true;
+		}
+	}
+
+	if( argc <= 1 )
+	{
+		std::remove(InputPath);
+		std::remove(OutputPath);
+	}
+	return Failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
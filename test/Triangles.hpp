@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <random>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/Types.hpp>
+
+// Random triangles shared by the tests and benchmarks
+
+// Sort points in clockwise order
+inline void SortClockwise(qTri::Triangle& CurTriangle)
+{
+	glm::i32vec2 Center{};
+	for( const glm::i32vec2& CurVert : CurTriangle )
+	{
+		Center += CurVert;
+	}
+	Center /= 3;
+	std::sort(
+		std::begin(CurTriangle),
+		std::end(CurTriangle),
+		[&Center](const glm::i32vec2& A, const glm::i32vec2& B) -> bool
+			{
+				// Sort points by its angle from the center
+				const glm::i32vec2 DirectionA = Center - A;
+				const glm::i32vec2 DirectionB = Center - B;
+				const auto AngleA = glm::atan<glm::float32_t>(DirectionA.y, DirectionA.x);
+				const auto AngleB = glm::atan<glm::float32_t>(DirectionB.y, DirectionB.x);
+				return AngleA < AngleB;
+			}
+	);
+}
+
+// Non-degenerate triangle with vertices within [Min, Max], wound such that
+// the edges face inwards
+// Degenerate triangles cover their whole line in the kernels, while views
+// only visit their bounds
+inline qTri::Triangle RandomTriangle(
+	std::mt19937& RandomEngine, const glm::i32vec2& Min, const glm::i32vec2& Max
+)
+{
+	std::uniform_int_distribution<std::int32_t> XDis(Min.x, Max.x);
+	std::uniform_int_distribution<std::int32_t> YDis(Min.y, Max.y);
+	qTri::Triangle CurTriangle;
+	do
+	{
+		for( glm::i32vec2& CurVert : CurTriangle )
+		{
+			CurVert = glm::i32vec2(XDis(RandomEngine), YDis(RandomEngine));
+		}
+	} while( qTri::Det(CurTriangle[1] - CurTriangle[0], CurTriangle[2] - CurTriangle[0]) == 0 );
+	if( qTri::Det(CurTriangle[1] - CurTriangle[0], CurTriangle[2] - CurTriangle[0]) < 0 )
+	{
+		std::swap(CurTriangle[1], CurTriangle[2]);
+	}
+	return CurTriangle;
+}
@@ -0,0 +1,345 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <qTriangle/qTriangle.hpp>
+#include <qTriangle/Kernels.hpp>
+#include <qTriangle/Util.hpp>
+
+#include "Triangles.hpp"
+
+constexpr std::size_t TileSize = 48;
+constexpr std::size_t AtlasTiles = 3;
+// Rows of the atlas are padded past its width
+constexpr std::size_t RowAlignment = 64;
+constexpr std::size_t TriangleCount = 64;
+
+// Non-degenerate triangle within and around a tile
+static qTri::Triangle RandomTriangle(std::mt19937& RandomEngine)
+{
+	return RandomTriangle(
+		RandomEngine, glm::i32vec2(-8), glm::i32vec2(TileSize + 8)
+	);
+}
+
+// Coverage of Tri by Fill over a dense grid of Width x Height points at Origin
+static std::vector<std::uint8_t> Reference(
+	std::size_t Width, std::size_t Height, glm::i32vec2 Origin,
+	const qTri::Triangle& Tri, qTri::FillFunction Fill
+)
+{
+	qTri::PointBuffer Points;
+	Points.reserve(Width * Height);
+	for( std::size_t y = 0; y < Height; ++y )
+	{
+		for( std::size_t x = 0; x < Width; ++x )
+		{
+			Points.push_back(Origin + glm::i32vec2(x, y));
+		}
+	}
+	std::vector<std::uint8_t> Results(Points.size());
+	Fill(Points.data(), Results.data(), Points.size(), Tri);
+	return Results;
+}
+
+// Compares the view against the reference and returns the mismatches
+static std::size_t Mismatches(
+	const qTri::ImageView& View, const std::vector<std::uint8_t>& Expected
+)
+{
+	std::size_t Count = 0;
+	for( std::size_t y = 0; y < View.Height; ++y )
+	{
+		for( std::size_t x = 0; x < View.Width; ++x )
+		{
+			Count += View.Row(y)[x] != Expected[x + y * View.Width];
+		}
+	}
+	return Count;
+}
+
+// Renders Tri twice straight into a PixelT image, then checks that each
+// pixel's coverage matches Expected
+template<typename PixelT>
+static std::size_t FormatMismatches(
+	const qTri::Triangle& Tri, const std::vector<std::uint8_t>& Expected
+)
+{
+	qTri::BasicImage<PixelT> Frame(TileSize, TileSize, RowAlignment);
+	qTri::FillView(qTri::BasicImageView<PixelT>(Frame), Tri);
+	qTri::FillView(qTri::BasicImageView<PixelT>(Frame), Tri);
+	std::size_t Count = 0;
+	for( std::size_t y = 0; y < Frame.Height; ++y )
+	{
+		for( std::size_t x = 0; x < Frame.Width; ++x )
+		{
+			Count += qTri::PixelFormat<PixelT>::Covered(Frame.Row(y), x)
+				!= Expected[x + y * Frame.Width];
+		}
+	}
+	return Count;
+}
+
+// Renders triangles in place into the tiles of a padded atlas and into a
+// viewport of a framebuffer, checking each against a dense rasterization
+int main()
+{
+	std::mt19937 RandomEngine(0x711E5);
+
+	std::size_t Failures = 0;
+	for( const auto& FillAlgorithm : qTri::FillAlgorithms )
+	{
+		qTri::Image Atlas(TileSize * AtlasTiles, TileSize * AtlasTiles, RowAlignment);
+		std::size_t CurFailures = 0;
+		for( std::size_t i = 0; i < TriangleCount; ++i )
+		{
+			const qTri::Triangle CurTriangle = RandomTriangle(RandomEngine);
+
+			// Every tile has its own coordinate space and is cleared first
+			const std::size_t Tile = i % (AtlasTiles * AtlasTiles);
+			qTri::ImageView TileView = qTri::ImageView(Atlas).SubView(
+				(Tile % AtlasTiles) * TileSize, (Tile / AtlasTiles) * TileSize,
+				TileSize, TileSize
+			);
+			TileView.Origin = glm::i32vec2(0);
+			for( std::size_t y = 0; y < TileView.Height; ++y )
+			{
+				std::fill_n(TileView.Row(y), TileView.Width, 0);
+			}
+			qTri::FillView(TileView, CurTriangle, FillAlgorithm.Fill);
+			CurFailures += Mismatches(
+				TileView,
+				Reference(
+					TileSize, TileSize, TileView.Origin, CurTriangle,
+					FillAlgorithm.Fill
+				)
+			);
+		}
+
+		// A viewport keeps the coordinates of the frame it is within
+		qTri::Image Frame(TileSize * 2, TileSize * 2);
+		const qTri::ImageView Viewport = qTri::ImageView(Frame).SubView(
+			TileSize / 2, TileSize / 3, TileSize, TileSize
+		);
+		const qTri::Triangle Large = {{
+			{0, 0}, {static_cast<std::int32_t>(TileSize * 2), 0},
+			{0, static_cast<std::int32_t>(TileSize * 2)}
+		}};
+		qTri::FillView(Viewport, Large, FillAlgorithm.Fill);
+		CurFailures += Mismatches(
+			Viewport,
+			Reference(
+				Viewport.Width, Viewport.Height, Viewport.Origin, Large,
+				FillAlgorithm.Fill
+			)
+		);
+		// Nothing outside of the viewport or within the padding is touched
+		std::size_t Outside = std::count(Frame.Pixels.begin(), Frame.Pixels.end(), 1);
+		for( std::size_t y = 0; y < Viewport.Height; ++y )
+		{
+			Outside -= std::count(Viewport.Row(y), Viewport.Row(y) + Viewport.Width, 1);
+		}
+		for( std::size_t y = 0; y < Atlas.Height; ++y )
+		{
+			Outside += std::count(Atlas.Row(y) + Atlas.Width, Atlas.Row(y) + Atlas.Stride, 1);
+		}
+		CurFailures += Outside;
+
+		std::printf("%s\t| %zu mismatches\n", FillAlgorithm.Name, CurFailures);
+		Failures += CurFailures;
+		if( &FillAlgorithm == &qTri::FillAlgorithms.front() )
+		{
+			qTri::Util::Draw(Viewport);
+		}
+	}
+
+	// Pixel formats written directly by the Cross-Product test
+	std::size_t FormatFailures = 0;
+	std::size_t CounterFailures = 0;
+	for( std::size_t i = 0; i < TriangleCount; ++i )
+	{
+		const qTri::Triangle CurTriangle = RandomTriangle(RandomEngine);
+		const std::vector<std::uint8_t> Expected = Reference(
+			TileSize, TileSize, glm::i32vec2(0), CurTriangle,
+			qTri::CrossProductMethod<0>
+		);
+		FormatFailures += FormatMismatches<qTri::Bit8>(CurTriangle, Expected);
+		FormatFailures += FormatMismatches<std::uint8_t>(CurTriangle, Expected);
+		FormatFailures += FormatMismatches<std::uint16_t>(CurTriangle, Expected);
+		FormatFailures += FormatMismatches<float>(CurTriangle, Expected);
+		FormatFailures += FormatMismatches<qTri::RGBA8>(CurTriangle, Expected);
+
+		// Counters accumulate every overlapping triangle
+		qTri::BasicImage<std::uint16_t> Counters(TileSize, TileSize);
+		for( std::size_t j = 0; j < 3; ++j )
+		{
+			qTri::FillView(qTri::BasicImageView<std::uint16_t>(Counters), CurTriangle);
+		}
+		for( std::size_t j = 0; j < Counters.Pixels.size(); ++j )
+		{
+			CounterFailures += Counters.Pixels[j] != Expected[j] * 3;
+		}
+	}
+	std::printf(
+		"Pixel formats\t| %zu mismatches, %zu counter mismatches\n",
+		FormatFailures, CounterFailures
+	);
+	Failures += FormatFailures + CounterFailures;
+
+	// Triangle IDs, the last triangle covering a pixel wins
+	constexpr std::uint32_t FirstID = 0x100;
+	std::vector<qTri::Triangle> Batch(TriangleCount);
+	std::vector<std::uint32_t> ExpectedIDs(TileSize * TileSize, qTri::NoTriangle);
+	for( std::size_t i = 0; i < Batch.size(); ++i )
+	{
+		Batch[i] = RandomTriangle(RandomEngine);
+		const std::vector<std::uint8_t> Expected = Reference(
+			TileSize, TileSize, glm::i32vec2(0), Batch[i],
+			qTri::CrossProductMethod<0>
+		);
+		for( std::size_t j = 0; j < Expected.size(); ++j )
+		{
+			if( Expected[j] )
+			{
+				ExpectedIDs[j] = FirstID + static_cast<std::uint32_t>(i);
+			}
+		}
+	}
+	qTri::BasicImage<std::uint32_t> IDs(TileSize, TileSize, RowAlignment);
+	std::fill(IDs.Pixels.begin(), IDs.Pixels.end(), qTri::NoTriangle);
+	qTri::VisibilityView(
+		qTri::BasicImageView<std::uint32_t>(IDs), Batch.data(), Batch.size(), FirstID
+	);
+	std::size_t IDFailures = 0;
+	for( std::size_t y = 0; y < IDs.Height; ++y )
+	{
+		for( std::size_t x = 0; x < IDs.Width; ++x )
+		{
+			IDFailures += IDs.Row(y)[x] != ExpectedIDs[x + y * IDs.Width];
+		}
+		// Padding is untouched
+		IDFailures += std::count_if(
+			IDs.Row(y) + IDs.Width, IDs.Row(y) + IDs.Stride,
+			[](std::uint32_t ID){ return ID != qTri::NoTriangle; }
+		);
+	}
+	std::printf("Visibility\t| %zu mismatches\n", IDFailures);
+	Failures += IDFailures;
+
+	// Opaque batches culled against what is already covered match drawing
+	// every triangle, within a view whose tiles do not line up with memory
+	std::size_t OpaqueFailures = 0;
+	std::size_t Rejected = 0;
+	qTri::BasicImage<std::uint32_t> Drawn(TileSize, TileSize);
+	qTri::BasicImage<std::uint32_t> Culled(TileSize, TileSize);
+	for( const bool FrontToBack : {false, true} )
+	{
+		std::fill(Drawn.Pixels.begin(), Drawn.Pixels.end(), qTri::NoTriangle);
+		std::fill(Culled.Pixels.begin(), Culled.Pixels.end(), qTri::NoTriangle);
+		const qTri::BasicImageView<std::uint32_t> DrawnView
+			= qTri::BasicImageView<std::uint32_t>(Drawn).SubView(3, 5, 37, 41);
+		const qTri::BasicImageView<std::uint32_t> CulledView
+			= qTri::BasicImageView<std::uint32_t>(Culled).SubView(3, 5, 37, 41);
+		// Front-to-back batches are drawn reversed to give the same IDs
+		std::vector<qTri::Triangle> Ordered(Batch);
+		if( FrontToBack )
+		{
+			std::reverse(Ordered.begin(), Ordered.end());
+		}
+		qTri::OcclusionTiles Occlusion(CulledView.Width, CulledView.Height);
+		// Two batches, the second lands behind the first
+		const std::size_t Split = Ordered.size() / 2;
+		const std::size_t Front = FrontToBack ? 0 : Split;
+		const std::size_t Back = FrontToBack ? Split : 0;
+		const std::size_t FrontCount = FrontToBack ? Split : Ordered.size() - Split;
+		const std::size_t BackCount = Ordered.size() - FrontCount;
+		Rejected += qTri::OpaqueVisibilityView(
+			CulledView, Occlusion, Ordered.data() + Front, FrontCount,
+			FirstID + static_cast<std::uint32_t>(Front), FrontToBack
+		);
+		Rejected += qTri::OpaqueVisibilityView(
+			CulledView, Occlusion, Ordered.data() + Back, BackCount,
+			FirstID + static_cast<std::uint32_t>(Back), FrontToBack
+		);
+		if( FrontToBack )
+		{
+			// IDs of the reversed batch name the same triangles
+			for( std::uint32_t& ID : Culled.Pixels )
+			{
+				if( ID != qTri::NoTriangle )
+				{
+					ID = FirstID + static_cast<std::uint32_t>(Ordered.size() - 1)
+						- (ID - FirstID);
+				}
+			}
+		}
+		qTri::VisibilityView(DrawnView, Batch.data(), Batch.size(), FirstID);
+		for( std::size_t j = 0; j < Drawn.Pixels.size(); ++j )
+		{
+			OpaqueFailures += Drawn.Pixels[j] != Culled.Pixels[j];
+		}
+	}
+	std::printf(
+		"Occlusion\t| %zu mismatches, %zu triangles rejected\n",
+		OpaqueFailures, Rejected
+	);
+	Failures += OpaqueFailures;
+
+	// Rounding of the blend against floating point
+	std::size_t RoundingFailures = 0;
+	for( std::uint32_t x = 0; x <= 255 * 255; ++x )
+	{
+		RoundingFailures += qTri::Div255(x) != static_cast<std::uint32_t>(x / 255.0 + 0.5);
+	}
+	// Blending fused into the test against blending the coverage afterwards
+	std::size_t BlendFailures = 0;
+	std::uniform_int_distribution<std::uint32_t> ByteDis(0, 255);
+	qTri::BasicImage<qTri::RGBA8> Blended(TileSize, TileSize);
+	for( qTri::RGBA8& CurPixel : Blended.Pixels )
+	{
+		CurPixel = qTri::RGBA8{
+			std::uint8_t(ByteDis(RandomEngine)), std::uint8_t(ByteDis(RandomEngine)),
+			std::uint8_t(ByteDis(RandomEngine)), std::uint8_t(ByteDis(RandomEngine))
+		};
+	}
+	for( std::size_t i = 0; i < TriangleCount; ++i )
+	{
+		const qTri::Triangle CurTriangle = RandomTriangle(RandomEngine);
+		// Premultiplied
+		const std::uint8_t Alpha = ByteDis(RandomEngine);
+		const qTri::RGBA8 Colour{
+			std::uint8_t(qTri::Div255(ByteDis(RandomEngine) * Alpha)),
+			std::uint8_t(qTri::Div255(ByteDis(RandomEngine) * Alpha)),
+			std::uint8_t(qTri::Div255(ByteDis(RandomEngine) * Alpha)),
+			Alpha
+		};
+		const std::vector<std::uint8_t> Expected = Reference(
+			TileSize, TileSize, glm::i32vec2(0), CurTriangle,
+			qTri::CrossProductMethod<0>
+		);
+		qTri::BasicImage<qTri::RGBA8> Previous(Blended);
+		qTri::BlendView(qTri::BasicImageView<qTri::RGBA8>(Blended), CurTriangle, Colour);
+		for( std::size_t j = 0; j < Blended.Pixels.size(); ++j )
+		{
+			const qTri::RGBA8 CurExpected = Expected[j]
+				? qTri::BlendOver(Previous.Pixels[j], Colour) : Previous.Pixels[j];
+			BlendFailures += std::memcmp(
+				&CurExpected, &Blended.Pixels[j], sizeof(qTri::RGBA8)
+			) != 0;
+		}
+	}
+	std::printf(
+		"Blending\t| %zu rounding mismatches, %zu blend mismatches\n",
+		RoundingFailures, BlendFailures
+	);
+	Failures += RoundingFailures + BlendFailures;
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}